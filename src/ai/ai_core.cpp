@@ -78,21 +78,27 @@
 	/* If we are in networking, only servers run this function, and that only if it is allowed */
 	if (_networking && (!_network_server || !_settings_game.ai.ai_in_multiplayer)) return;
 
-	/* The speed with which AIs go, is limited by the 'competitor_speed' */
+	/* The speed with which AIs go, is limited by the 'competitor_speed'.
+	 * Each AI is run on a different tick within that interval, such that the cost
+	 * of running many AIs is spread evenly over ticks, instead of all AIs being run on
+	 * the same tick. */
 	AI::frame_counter++;
 	assert(_settings_game.difficulty.competitor_speed <= 4);
-	if ((AI::frame_counter & ((1 << (4 - _settings_game.difficulty.competitor_speed)) - 1)) != 0) return;
+	const uint interval_mask = (1 << (4 - _settings_game.difficulty.competitor_speed)) - 1;
 
 	Backup<CompanyID> cur_company(_current_company, FILE_LINE);
 	for (const Company *c : Company::Iterate()) {
 		if (c->is_ai) {
+			const uint ai_tick = AI::frame_counter + c->index;
+			if ((ai_tick & interval_mask) != 0) continue;
+
 			SCOPE_INFO_FMT([&], "AI::GameLoop: %i: %s (v%d)\n", (int)c->index, c->ai_info->GetName().c_str(), c->ai_info->GetVersion());
 			PerformanceMeasurer framerate((PerformanceElement)(PFE_AI0 + c->index));
 			cur_company.Change(c->index);
 			c->ai_instance->GameLoop();
 			/* Occasionally collect garbage; every 255 ticks do one company.
 			 * Effectively collecting garbage once every two months per AI. */
-			if ((AI::frame_counter & 255) == 0 && (CompanyID)GB(AI::frame_counter, 8, 4) == c->index) {
+			if ((ai_tick & 255) == 0 && (CompanyID)GB(ai_tick, 8, 4) == c->index) {
 				c->ai_instance->CollectGarbage();
 			}
 		} else {
@@ -15,15 +15,91 @@
 #include "viewport_func.h"
 #include "framerate_type.h"
 #include "date_func.h"
+#include "string_func.h"
 #include "3rdparty/cpp-btree/btree_map.h"
-
-#include INCLUDE_FOR_PREFETCH_NTA
+#include "3rdparty/cpp-btree/btree_set.h"
+#include <array>
+#include <vector>
 
 #include "safeguards.h"
 
 /** The table/list with animated tiles. */
 btree::btree_map<TileIndex, AnimatedTileInfo> _animated_tiles;
 
+/** Speeds above this are never animated, see AnimateAnimatedTiles. */
+static const uint8_t MAX_ANIMATED_TILE_SPEED = 32;
+
+/** NOSAVE: Tiles in _animated_tiles which are not pending deletion, indexed by speed. Tiles with speeds above MAX_ANIMATED_TILE_SPEED are not included. */
+static std::array<btree::btree_set<TileIndex>, MAX_ANIMATED_TILE_SPEED + 1> _animated_tile_speed_index;
+
+/** NOSAVE: Bit mask of the non-empty sets in _animated_tile_speed_index. */
+static uint64_t _animated_tile_speed_index_mask = 0;
+
+/** NOSAVE: Tiles which have been marked as pending deletion in _animated_tiles, and which are to be erased by the next AnimateAnimatedTiles. */
+static std::vector<TileIndex> _animated_tiles_pending_deletion;
+
+static void AddAnimatedTileToSpeedIndex(TileIndex tile, uint8_t speed)
+{
+	if (speed > MAX_ANIMATED_TILE_SPEED) return;
+	_animated_tile_speed_index[speed].insert(tile);
+	SetBit(_animated_tile_speed_index_mask, speed);
+}
+
+static void RemoveAnimatedTileFromSpeedIndex(TileIndex tile, uint8_t speed)
+{
+	if (speed > MAX_ANIMATED_TILE_SPEED) return;
+	_animated_tile_speed_index[speed].erase(tile);
+	if (_animated_tile_speed_index[speed].empty()) ClrBit(_animated_tile_speed_index_mask, speed);
+}
+
+/**
+ * Rebuild the per-speed index of the animated tile table.
+ * This must be called after the animated tile table has been modified directly, e.g. when loading.
+ */
+void RebuildAnimatedTileSpeedIndex()
+{
+	for (auto &tiles : _animated_tile_speed_index) {
+		tiles.clear();
+	}
+	_animated_tile_speed_index_mask = 0;
+	_animated_tiles_pending_deletion.clear();
+
+	for (const auto &it : _animated_tiles) {
+		if (it.second.pending_deletion) {
+			_animated_tiles_pending_deletion.push_back(it.first);
+		} else {
+			AddAnimatedTileToSpeedIndex(it.first, it.second.speed);
+		}
+	}
+}
+
+/**
+ * Check that the per-speed index of the animated tile table is consistent with the table.
+ * @return Empty string if the index is valid, otherwise a description of the first problem found.
+ */
+std::string ValidateAnimatedTileSpeedIndex()
+{
+	size_t count = 0;
+	for (const auto &it : _animated_tiles) {
+		if (it.second.pending_deletion || it.second.speed > MAX_ANIMATED_TILE_SPEED) continue;
+		count++;
+		if (!_animated_tile_speed_index[it.second.speed].contains(it.first)) {
+			return stdstr_fmt("Tile 0x%X, speed %u missing from speed index", it.first, it.second.speed);
+		}
+	}
+
+	size_t index_count = 0;
+	for (uint8_t speed = 0; speed <= MAX_ANIMATED_TILE_SPEED; speed++) {
+		index_count += _animated_tile_speed_index[speed].size();
+		if (HasBit(_animated_tile_speed_index_mask, speed) == _animated_tile_speed_index[speed].empty()) {
+			return stdstr_fmt("Speed index mask mismatch for speed %u", speed);
+		}
+	}
+	if (index_count != count) return stdstr_fmt("Speed index count mismatch: %u != %u", (uint)index_count, (uint)count);
+
+	return "";
+}
+
 /**
  * Removes the given tile from the animated tile table.
  * @param tile the tile to remove
@@ -33,6 +109,8 @@ void DeleteAnimatedTile(TileIndex tile)
 	auto to_remove = _animated_tiles.find(tile);
 	if (to_remove != _animated_tiles.end() && !to_remove->second.pending_deletion) {
 		to_remove->second.pending_deletion = true;
+		RemoveAnimatedTileFromSpeedIndex(tile, to_remove->second.speed);
+		_animated_tiles_pending_deletion.push_back(tile);
 		MarkTileDirtyByTile(tile, VMDF_NOT_MAP_MODE);
 	}
 }
@@ -75,9 +153,16 @@ static void UpdateAnimatedTileSpeed(TileIndex tile, AnimatedTileInfo &info)
 void AddAnimatedTile(TileIndex tile, bool mark_dirty)
 {
 	if (mark_dirty) MarkTileDirtyByTile(tile, VMDF_NOT_MAP_MODE);
-	AnimatedTileInfo &info = _animated_tiles[tile];
+	auto iter = _animated_tiles.find(tile);
+	if (iter == _animated_tiles.end()) {
+		iter = _animated_tiles.insert({ tile, {} }).first;
+	} else if (!iter->second.pending_deletion) {
+		RemoveAnimatedTileFromSpeedIndex(tile, iter->second.speed);
+	}
+	AnimatedTileInfo &info = iter->second;
 	UpdateAnimatedTileSpeed(tile, info);
 	info.pending_deletion = false;
+	AddAnimatedTileToSpeedIndex(tile, info.speed);
 }
 
 int GetAnimatedTileSpeed(TileIndex tile)
@@ -91,6 +176,7 @@ int GetAnimatedTileSpeed(TileIndex tile)
 
 /**
  * Animate all tiles in the animated tile list, i.e.\ call AnimateTile on them.
+ * Only the tiles which are due on this tick are visited, in ascending tile order.
  */
 void AnimateAnimatedTiles()
 {
@@ -101,46 +187,52 @@ void AnimateAnimatedTiles()
 
 	PerformanceAccumulator framerate(PFE_GL_LANDSCAPE);
 
+	for (TileIndex tile : _animated_tiles_pending_deletion) {
+		auto iter = _animated_tiles.find(tile);
+		if (iter != _animated_tiles.end() && iter->second.pending_deletion) _animated_tiles.erase(iter);
+	}
+	_animated_tiles_pending_deletion.clear();
+
 	const uint32_t ticks = (uint) _scaled_tick_counter;
 	const uint8_t max_speed = (ticks == 0) ? 32 : FindFirstBit(ticks);
+	static_assert(MAX_ANIMATED_TILE_SPEED == 32);
 
-	auto iter = _animated_tiles.begin();
-	while (iter != _animated_tiles.end()) {
-		if (iter->second.pending_deletion) {
-			iter = _animated_tiles.erase(iter);
-			continue;
-		}
+	/* Tiles with speed <= max_speed are animated on this tick.
+	 * Animating a tile may add, remove or change the speed of tiles, so no iterators are held across calls to AnimateTile. */
+	const uint64_t due_speeds = GetBitMaskSC<uint64_t>(0, max_speed + 1);
+	TileIndex next_tile = 0;
+	while (true) {
+		const uint64_t speeds = _animated_tile_speed_index_mask & due_speeds;
+		if (speeds == 0) break;
 
-		auto next = iter;
-		++next;
-		if (next != _animated_tiles.end()) {
-			PREFETCH_NTA(&(next->second));
+		TileIndex curr = INVALID_TILE;
+		for (uint8_t speed : SetBitIterator<uint8_t, uint64_t>(speeds)) {
+			auto iter = _animated_tile_speed_index[speed].lower_bound(next_tile);
+			if (iter != _animated_tile_speed_index[speed].end() && *iter < curr) curr = *iter;
 		}
+		if (curr == INVALID_TILE) break;
+		next_tile = curr + 1;
 
-		if (iter->second.speed <= max_speed) {
-			const TileIndex curr = iter->first;
-			switch (GetTileType(curr)) {
-				case MP_HOUSE:
-					AnimateTile_Town(curr);
-					break;
+		switch (GetTileType(curr)) {
+			case MP_HOUSE:
+				AnimateTile_Town(curr);
+				break;
 
-				case MP_STATION:
-					AnimateTile_Station(curr);
-					break;
+			case MP_STATION:
+				AnimateTile_Station(curr);
+				break;
 
-				case MP_INDUSTRY:
-					AnimateTile_Industry(curr);
-					break;
+			case MP_INDUSTRY:
+				AnimateTile_Industry(curr);
+				break;
 
-				case MP_OBJECT:
-					AnimateTile_Object(curr);
-					break;
+			case MP_OBJECT:
+				AnimateTile_Object(curr);
+				break;
 
-				default:
-					NOT_REACHED();
-			}
+			default:
+				NOT_REACHED();
 		}
-		iter = next;
 	}
 }
 
@@ -155,6 +247,7 @@ void UpdateAllAnimatedTileSpeeds()
 		UpdateAnimatedTileSpeed(iter->first, iter->second);
 		++iter;
 	}
+	RebuildAnimatedTileSpeedIndex();
 }
 
 /**
@@ -163,4 +256,5 @@ void UpdateAllAnimatedTileSpeeds()
 void InitializeAnimatedTiles()
 {
 	_animated_tiles.clear();
+	RebuildAnimatedTileSpeedIndex();
 }
@@ -16,6 +16,7 @@ void AddAnimatedTile(TileIndex tile, bool mark_dirty = true);
 void DeleteAnimatedTile(TileIndex tile);
 void AnimateAnimatedTiles();
 void UpdateAllAnimatedTileSpeeds();
+void RebuildAnimatedTileSpeedIndex();
 void InitializeAnimatedTiles();
 
 #endif /* ANIMATED_TILE_FUNC_H */
@@ -15,6 +15,7 @@
 #include "debug.h"
 #include "debug_desync.h"
 #include "debug_settings.h"
+#include "group.h"
 #include "industry.h"
 #include "roadstop_base.h"
 #include "roadveh.h"
@@ -38,6 +39,22 @@ extern void AfterLoadCompanyStats();
 extern void RebuildTownCaches(bool cargo_update_required, bool old_map_position);
 extern void WriteVehicleInfo(char *&p, const char *last, const Vehicle *u, const Vehicle *v, uint length);
 
+/** Steps of the cache check, used when checking incrementally. */
+enum CheckCachesPhase : uint8_t {
+	CCP_BEGIN = 0,
+	CCP_TOWNS_STATIONS = 0,   ///< Town, station catchment and industry caches.
+	CCP_INFRA_TOTALS,         ///< Company infrastructure totals.
+	CCP_VEHICLES,             ///< Vehicle caches, in slices of the vehicle pool.
+	CCP_STATIONS,             ///< Station cargo and docking caches, in slices of the station pool.
+	CCP_MISC,                 ///< Other caches and indexes.
+	CCP_WATER_REGIONS,        ///< Water regions.
+	CCP_END,
+};
+DECLARE_POSTFIX_INCREMENT(CheckCachesPhase)
+
+static constexpr uint32_t INCREMENTAL_VEHICLE_SLICE_SIZE = 256;
+static constexpr uint32_t INCREMENTAL_STATION_SLICE_SIZE = 64;
+
 static bool SignalInfraTotalMatches()
 {
 	std::array<int, MAX_COMPANIES> old_signal_totals = {};
@@ -94,15 +111,51 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 			if (!SignalInfraTotalMatches()) desync_level = 2;
 		}
 
-		/* Return here so it is easy to add checks that are run
-		 * always to aid testing of caches. */
-		if (desync_level < 1) return;
+		if (unlikely(HasChickenBit(DCBF_DESYNC_CHECK_INCREMENTAL)) && desync_level < 1) {
+			flags |= CHECK_CACHE_INCREMENTAL;
+		} else {
+			/* Return here so it is easy to add checks that are run
+			 * always to aid testing of caches. */
+			if (desync_level < 1) return;
+		}
 
 		if (desync_level == 1 && _state_ticks.base() % 500 != 0) return;
 	}
 
 	SCOPE_INFO_FMT([flags], "CheckCaches: %X", flags);
 
+	/* In incremental mode, only one step of the complete check is performed per call.
+	 * The step is derived from the tick counter so that all clients check the same step on the same tick. */
+	CheckCachesPhase phase = CCP_END;
+	std::pair<uint32_t, uint32_t> vehicle_slice = { 0, UINT32_MAX };
+	std::pair<uint32_t, uint32_t> station_slice = { 0, UINT32_MAX };
+	if (flags & CHECK_CACHE_INCREMENTAL) {
+		const uint32_t vehicle_steps = std::max<uint32_t>(1, CeilDivT<uint32_t>((uint32_t)Vehicle::GetPoolSize(), INCREMENTAL_VEHICLE_SLICE_SIZE));
+		const uint32_t station_steps = std::max<uint32_t>(1, CeilDivT<uint32_t>((uint32_t)Station::GetPoolSize(), INCREMENTAL_STATION_SLICE_SIZE));
+		uint32_t step = _state_ticks.base() % (CCP_END - 2 + vehicle_steps + station_steps);
+		for (phase = CCP_BEGIN; phase < CCP_END; phase++) {
+			if (phase == CCP_VEHICLES) {
+				if (step < vehicle_steps) {
+					vehicle_slice = { step * INCREMENTAL_VEHICLE_SLICE_SIZE, (step + 1) * INCREMENTAL_VEHICLE_SLICE_SIZE };
+					break;
+				}
+				step -= vehicle_steps;
+			} else if (phase == CCP_STATIONS) {
+				if (step < station_steps) {
+					station_slice = { step * INCREMENTAL_STATION_SLICE_SIZE, (step + 1) * INCREMENTAL_STATION_SLICE_SIZE };
+					break;
+				}
+				step -= station_steps;
+			} else {
+				if (step == 0) break;
+				step--;
+			}
+		}
+	}
+	auto in_phase = [&](CheckCachesPhase p) -> bool {
+		return phase == CCP_END || phase == p;
+	};
+
 	std::vector<std::string> saved_messages;
 	std::function<void(const char *)> log_orig;
 	if (flags & CHECK_CACHE_EMIT_LOG) {
@@ -151,7 +204,7 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 	cclog_common(); \
 }
 
-	if (flags & CHECK_CACHE_GENERAL) {
+	if ((flags & CHECK_CACHE_GENERAL) && in_phase(CCP_TOWNS_STATIONS)) {
 		/* Check the town caches. */
 		std::vector<TownCache> old_town_caches;
 		std::vector<StationList> old_town_stations_nears;
@@ -239,7 +292,7 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 		}
 	}
 
-	if (flags & CHECK_CACHE_INFRA_TOTALS) {
+	if ((flags & CHECK_CACHE_INFRA_TOTALS) && in_phase(CCP_INFRA_TOTALS)) {
 		/* Check company infrastructure cache. */
 		std::vector<CompanyInfrastructure> old_infrastructure;
 		for (const Company *c : Company::Iterate()) old_infrastructure.push_back(c->infrastructure);
@@ -269,7 +322,7 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 		}
 	}
 
-	if (flags & CHECK_CACHE_GENERAL) {
+	if ((flags & CHECK_CACHE_GENERAL) && in_phase(CCP_MISC)) {
 		/* Strict checking of the road stop cache entries */
 		for (const RoadStop *rs : RoadStop::Iterate()) {
 			if (IsBayRoadStopTile(rs->xy)) continue;
@@ -278,6 +331,9 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 			rs->GetEntry(DIAGDIR_NE)->CheckIntegrity(rs);
 			rs->GetEntry(DIAGDIR_NW)->CheckIntegrity(rs);
 		}
+	}
+
+	if ((flags & CHECK_CACHE_GENERAL) && in_phase(CCP_VEHICLES)) {
 
 		std::vector<NewGRFCache> grf_cache;
 		std::vector<VehicleCache> veh_cache;
@@ -286,7 +342,9 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 		std::vector<AircraftCache> air_cache;
 		std::vector<std::unique_ptr<Vehicle, FreeDeleter>> veh_old;
 
-		for (Vehicle *v : Vehicle::Iterate()) {
+		for (Vehicle *v : Vehicle::Iterate(vehicle_slice.first)) {
+			if (v->index >= vehicle_slice.second) break;
+
 			extern bool ValidateVehicleTileHash(const Vehicle *v);
 			if (!ValidateVehicleTileHash(v)) {
 				CCLOG("vehicle tile hash mismatch: type %i, vehicle %i, company %i, unit number %i", (int)v->type, v->index, (int)v->owner, v->unitnumber);
@@ -454,7 +512,9 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 		}
 
 		/* Check whether the caches are still valid */
-		for (Vehicle *v : Vehicle::Iterate()) {
+		for (Vehicle *v : Vehicle::Iterate(vehicle_slice.first)) {
+			if (v->index >= vehicle_slice.second) break;
+
 			Money old_feeder_share = v->cargo.GetFeederShare();
 			uint old_count = v->cargo.TotalCount();
 			uint64_t old_cargo_periods_in_transit = v->cargo.CargoPeriodsInTransit();
@@ -472,8 +532,12 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 						HasBit(changed, 2) ? 'p' : '-');
 			}
 		}
+	}
+
+	if ((flags & CHECK_CACHE_GENERAL) && in_phase(CCP_STATIONS)) {
+		for (Station *st : Station::Iterate(station_slice.first)) {
+			if (st->index >= station_slice.second) break;
 
-		for (Station *st : Station::Iterate()) {
 			for (CargoID c = 0; c < NUM_CARGO; c++) {
 				if (st->goods[c].data == nullptr) continue;
 
@@ -511,7 +575,9 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 				}
 			}
 		}
+	}
 
+	if ((flags & CHECK_CACHE_GENERAL) && in_phase(CCP_MISC)) {
 #ifdef WITH_ASSERT
 		for (OrderList *order_list : OrderList::Iterate()) {
 			order_list->DebugCheckSanity();
@@ -530,6 +596,14 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 			if (tv->Next()) assert_msg(tv->Next()->Prev() == tv, "%u", tv->index);
 		}
 
+		{
+			extern std::string ValidateAnimatedTileSpeedIndex();
+			std::string animated_tile_validation_result = ValidateAnimatedTileSpeedIndex();
+			if (!animated_tile_validation_result.empty()) {
+				CCLOG("Animated tile speed index validation failed: %s", animated_tile_validation_result.c_str());
+			}
+		}
+
 		{
 			extern std::string ValidateTemplateReplacementCaches();
 			std::string template_validation_result = ValidateTemplateReplacementCaches();
@@ -539,6 +613,7 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 		}
 
 		if (!TraceRestrictSlot::ValidateVehicleIndex()) CCLOG("Trace restrict slot vehicle index validation failed");
+		if (!GroupStatistics::ValidateVehicleIndex()) CCLOG("Group vehicle index validation failed");
 		TraceRestrictSlot::ValidateSlotOccupants(log);
 
 		if (!CargoPacket::ValidateDeferredCargoPayments()) CCLOG("Cargo packets deferred payments validation failed");
@@ -559,7 +634,7 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 		}
 	}
 
-	if (flags & CHECK_CACHE_WATER_REGIONS) {
+	if ((flags & CHECK_CACHE_WATER_REGIONS) && in_phase(CCP_WATER_REGIONS)) {
 		extern void WaterRegionCheckCaches(std::function<void(const char *)> log);
 		WaterRegionCheckCaches(log);
 	}
@@ -423,6 +423,7 @@ void VehicleCargoList::Append(CargoPacket *cp, MoveToAction action)
 	dbg_assert(cp != nullptr);
 	dbg_assert(action == MTA_LOAD ||
 			(action == MTA_KEEP && this->action_counts[MTA_LOAD] == 0));
+	this->ApplyPendingAging();
 	this->AddToMeta(cp, action);
 
 	if (this->count == cp->count) {
@@ -455,6 +456,7 @@ void VehicleCargoList::Append(CargoPacket *cp, MoveToAction action)
 template<class Taction>
 void VehicleCargoList::ShiftCargo(Taction action)
 {
+	this->ApplyPendingAging();
 	Iterator it(this->packets.begin());
 	while (it != this->packets.end() && action.MaxMove() > 0) {
 		CargoPacket *cp = *it;
@@ -479,6 +481,7 @@ void VehicleCargoList::ShiftCargo(Taction action)
 template<class Taction, class Tfilter>
 void VehicleCargoList::ShiftCargoWithFrontInsert(Taction action, Tfilter filter)
 {
+	this->ApplyPendingAging();
 	std::vector<CargoPacket *> packets_to_front_insert;
 
 	Iterator it(this->packets.begin());
@@ -512,6 +515,7 @@ template<class Taction>
 void VehicleCargoList::PopCargo(Taction action)
 {
 	if (this->packets.empty()) return;
+	this->ApplyPendingAging();
 	for (auto it = this->packets.end(); it != this->packets.begin();) {
 		if (action.MaxMove() <= 0) break;
 		--it;
@@ -543,7 +547,9 @@ void VehicleCargoList::RemoveFromCache(const CargoPacket *cp, uint count)
  */
 void VehicleCargoList::AddToCache(const CargoPacket *cp)
 {
+	dbg_assert(this->pending_aging_periods == 0);
 	this->feeder_share += cp->feeder_share;
+	this->lazy_aging_headroom = 0;
 	this->Parent::AddToCache(cp);
 }
 
@@ -577,16 +583,42 @@ void VehicleCargoList::AddToMeta(const CargoPacket *cp, MoveToAction action)
 
 /**
  * Ages the all cargo in this list.
+ * Whilst no packet can reach the maximum age, the aging is only recorded in the
+ * cache and applied to the packets later, when they are next accessed.
  */
 void VehicleCargoList::AgeCargo()
 {
+	if (this->lazy_aging_headroom > 0) {
+		this->lazy_aging_headroom--;
+		this->pending_aging_periods++;
+		this->cargo_periods_in_transit += this->count;
+		return;
+	}
+
+	this->ApplyPendingAging();
+	uint16_t max_periods = 0;
 	for (const auto &cp : this->packets) {
 		/* If we're at the maximum, then we can't increase no more. */
-		if (cp->periods_in_transit == UINT16_MAX) continue;
+		if (cp->periods_in_transit != UINT16_MAX) {
+			cp->periods_in_transit++;
+			this->cargo_periods_in_transit += cp->count;
+		}
+		max_periods = std::max(max_periods, cp->periods_in_transit);
+	}
+	this->lazy_aging_headroom = UINT16_MAX - max_periods;
+}
 
-		cp->periods_in_transit++;
-		this->cargo_periods_in_transit += cp->count;
+/**
+ * Apply deferred aging periods to all packets in this list.
+ * The cached sum of periods in transit already includes these.
+ */
+void VehicleCargoList::ApplyPendingAgingIntl() const
+{
+	for (CargoPacket *cp : this->packets) {
+		dbg_assert(cp->periods_in_transit <= UINT16_MAX - this->pending_aging_periods);
+		cp->periods_in_transit += this->pending_aging_periods;
 	}
+	this->pending_aging_periods = 0;
 }
 
 /**
@@ -630,6 +662,7 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, StationID
 {
 	this->AssertCountConsistency();
 	dbg_assert(this->action_counts[MTA_LOAD] == 0);
+	this->ApplyPendingAging();
 	this->action_counts[MTA_TRANSFER] = this->action_counts[MTA_DELIVER] = this->action_counts[MTA_KEEP] = 0;
 	Iterator it = this->packets.begin();
 	uint sum = 0;
@@ -725,6 +758,7 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, StationID
 /** Invalidates the cached data and rebuild it. */
 void VehicleCargoList::InvalidateCache()
 {
+	this->ApplyPendingAging();
 	this->feeder_share = 0;
 	this->Parent::InvalidateCache();
 }
@@ -762,6 +796,7 @@ template<>
 uint VehicleCargoList::Reassign<VehicleCargoList::MTA_DELIVER, VehicleCargoList::MTA_TRANSFER>(uint max_move)
 {
 	max_move = std::min(this->action_counts[MTA_DELIVER], max_move);
+	this->ApplyPendingAging();
 
 	uint sum = 0;
 	for (Iterator it(this->packets.begin()); sum < this->action_counts[MTA_TRANSFER] + max_move;) {
@@ -863,6 +898,7 @@ uint VehicleCargoList::Truncate(uint max_move)
 uint VehicleCargoList::Reroute(uint max_move, VehicleCargoList *dest, StationID avoid, StationID avoid2, const GoodsEntry *ge)
 {
 	max_move = std::min(this->action_counts[MTA_TRANSFER], max_move);
+	dest->ApplyPendingAging();
 	this->ShiftCargoWithFrontInsert(VehicleCargoReroute(this, dest, max_move, avoid, avoid2, ge), [](CargoPacket *cp) { return true; });
 	return max_move;
 }
@@ -879,6 +915,7 @@ uint VehicleCargoList::Reroute(uint max_move, VehicleCargoList *dest, StationID
 uint VehicleCargoList::RerouteFromSource(uint max_move, VehicleCargoList *dest, StationID source, StationID avoid, StationID avoid2, const GoodsEntry *ge)
 {
 	max_move = std::min(this->action_counts[MTA_TRANSFER], max_move);
+	dest->ApplyPendingAging();
 	this->ShiftCargoWithFrontInsert(VehicleCargoReroute(this, dest, max_move, avoid, avoid2, ge), [source](CargoPacket *cp) { return cp->GetFirstStation() == source; });
 	return max_move;
 }
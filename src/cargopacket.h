@@ -384,6 +384,8 @@ protected:
 
 	Money feeder_share;                     ///< Cache for the feeder share.
 	uint action_counts[NUM_MOVE_TO_ACTION]; ///< Counts of cargo to be transferred, delivered, kept and loaded.
+	mutable uint16_t pending_aging_periods = 0; ///< NOSAVE: Aging periods already included in cargo_periods_in_transit, but not yet applied to the packets.
+	uint16_t lazy_aging_headroom = 0;       ///< NOSAVE: Number of aging periods which can be deferred before any packet could reach the maximum age.
 
 	template<class Taction>
 	void ShiftCargo(Taction action);
@@ -394,6 +396,8 @@ protected:
 	template<class Taction>
 	void PopCargo(Taction action);
 
+	void ApplyPendingAgingIntl() const;
+
 	inline uint RecalculateCargoTotal() const
 	{
 		uint total = 0;
@@ -451,6 +455,26 @@ public:
 	friend class CargoReturn;
 	friend class VehicleCargoReroute;
 
+	/**
+	 * Apply any deferred aging periods to the packets in this list.
+	 * This must be done before the periods in transit of individual packets are used.
+	 */
+	inline void ApplyPendingAging() const
+	{
+		if (this->pending_aging_periods != 0) this->ApplyPendingAgingIntl();
+	}
+
+	/**
+	 * Returns a pointer to the cargo packet list (so you can iterate over it etc).
+	 * Any deferred aging is applied first.
+	 * @return Pointer to the packet list.
+	 */
+	inline const CargoPacketList *Packets() const
+	{
+		this->ApplyPendingAging();
+		return &this->packets;
+	}
+
 	/**
 	 * Returns the first station of the first cargo packet in this list.
 	 * @return The before mentioned station.
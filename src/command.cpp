@@ -320,6 +320,8 @@ CommandProc CmdAcquireUnownedPlan;
 
 CommandProc CmdDesyncCheck;
 
+CommandProcAux CmdBatchCommands;
+
 #define DEF_CMD(proc, flags, type) Command(proc, #proc, (CommandFlags)flags, type)
 
 /**
@@ -587,6 +589,8 @@ static const Command _command_proc_table[] = {
 	DEF_CMD(CmdAcquireUnownedPlan,                 CMD_SERVER_NS, CMDT_OTHER_MANAGEMENT      ), // CMD_ACQUIRE_UNOWNED_PLAN
 
 	DEF_CMD(CmdDesyncCheck,                           CMD_SERVER, CMDT_SERVER_SETTING        ), // CMD_DESYNC_CHECK
+
+	DEF_CMD(CmdBatchCommands,                        CMD_NO_TEST, CMDT_LANDSCAPE_CONSTRUCTION), // CMD_BATCH_COMMANDS
 };
 static_assert(lengthof(_command_proc_table) == CMD_END);
 
@@ -1298,7 +1302,7 @@ CommandCost DoCommandPInternal(TileIndex tile, uint32_t p1, uint32_t p2, uint64_
 	}
 
 	SubtractMoneyFromCompany(res2);
-	if (_networking) UpdateStateChecksum(res2.GetCost());
+	if (_networking) UpdateStateChecksum(SCS_COMPANY, res2.GetCost());
 
 	/* update signals if needed */
 	UpdateSignalsInBuffer();
@@ -1311,6 +1315,150 @@ CommandCost DoCommandPInternal(TileIndex tile, uint32_t p1, uint32_t p2, uint64_
 }
 #undef return_dcpi
 
+struct BatchCommandsCmdData : public CommandAuxiliarySerialisable<BatchCommandsCmdData> {
+	std::vector<CommandBatchItem> items;
+
+	virtual void Serialise(CommandSerialisationBuffer &buffer) const override
+	{
+		buffer.Send_uint32((uint32_t)this->items.size());
+		for (const CommandBatchItem &item : this->items) {
+			buffer.Send_uint32(item.tile);
+			buffer.Send_uint32(item.p1);
+			buffer.Send_uint32(item.p2);
+			buffer.Send_uint64(item.p3);
+			buffer.Send_uint8(item.cmd & CMD_ID_MASK);
+		}
+	}
+
+	CommandCost Deserialise(CommandDeserialisationBuffer &buffer)
+	{
+		uint32_t size = buffer.Recv_uint32();
+		if (size > MAX_COMMAND_BATCH_SIZE || !buffer.CanRecvBytes(size * 21)) return CMD_ERROR;
+		this->items.resize(size);
+		for (CommandBatchItem &item : this->items) {
+			item.tile = buffer.Recv_uint32();
+			item.p1 = buffer.Recv_uint32();
+			item.p2 = buffer.Recv_uint32();
+			item.p3 = buffer.Recv_uint64();
+			item.cmd = buffer.Recv_uint8();
+		}
+		return CommandCost();
+	}
+
+	std::string GetDebugSummary() const override
+	{
+		if (this->items.empty()) return "0 commands";
+		return stdstr_fmt("%u commands, first: %s", (uint32_t)this->items.size(), IsValidCommand(this->items[0].cmd) ? GetCommandName(this->items[0].cmd) : "invalid");
+	}
+};
+
+/**
+ * Check whether a command may be part of a #CMD_BATCH_COMMANDS batch.
+ * Only plain landscape construction commands which are neither server/spectator commands, nor use text or auxiliary data are allowed.
+ * @param item The batched command to check.
+ * @return true if the command may be batched.
+ */
+static bool IsCommandBatchable(const CommandBatchItem &item)
+{
+	if (!IsValidCommand(item.cmd) || (item.cmd & CMD_ID_MASK) == CMD_BATCH_COMMANDS) return false;
+
+	const Command &command = _command_proc_table[item.cmd & CMD_ID_MASK];
+	if (command.type != CMDT_LANDSCAPE_CONSTRUCTION || GetCommandArgMode(item.cmd) == CMD_ARG_AUX) return false;
+	if ((command.flags & (CMD_SERVER | CMD_SPECTATOR | CMD_OFFLINE | CMD_CLIENT_ID | CMD_SERVER_NS)) != 0) return false;
+
+	/* The tile of the batch itself is not checked by DoCommandP, so check each batched tile the same way */
+	return item.tile == 0 || (item.tile < MapSize() && (IsValidTile(item.tile) || (command.flags & CMD_ALL_TILES) != 0));
+}
+
+/**
+ * Execute a batch of landscape construction commands as a single command.
+ * This allows a large number of related commands to be sent, queued and logged as one command instead of many individual ones.
+ * The commands are tested and executed in order, failing commands are skipped.
+ * When executing, commands with #CMD_NO_TEST are not tested first, as for those the test run may fail where the execution would not.
+ * @param tile unused
+ * @param flags type of operation
+ * @param aux_data the commands to execute
+ * @return the total cost of the successful commands, or the error of the last failed command if none succeeded
+ */
+CommandCost CmdBatchCommands(TileIndex tile, DoCommandFlag flags, const CommandAuxiliaryBase *aux_data)
+{
+	CommandAuxData<BatchCommandsCmdData> data;
+	CommandCost ret = data.Load(aux_data);
+	if (ret.Failed()) return ret;
+
+	if (data->items.empty() || data->items.size() > MAX_COMMAND_BATCH_SIZE) return CMD_ERROR;
+	for (const CommandBatchItem &item : data->items) {
+		if (!IsCommandBatchable(item)) return CMD_ERROR;
+	}
+
+	Money money = GetAvailableMoneyForCommand();
+	CommandCost cost(EXPENSES_CONSTRUCTION);
+	CommandCost last_error = CMD_ERROR;
+	bool had_success = false;
+
+	for (const CommandBatchItem &item : data->items) {
+		const CommandFlags cmd_flags = GetCommandFlags(item.cmd);
+		const DoCommandFlag item_flags = flags | CommandFlagsToDCFlags(cmd_flags);
+		const bool skip_test = (flags & DC_EXEC) && ((cmd_flags & CMD_NO_TEST) != 0 || HasChickenBit(DCBF_CMD_NO_TEST_ALL));
+
+		if (!skip_test) {
+			_cleared_object_areas.clear();
+			ret = DoCommandEx(item.tile, item.p1, item.p2, item.p3, item_flags & ~DC_EXEC, item.cmd);
+			if (ret.Failed()) {
+				last_error = ret;
+				continue;
+			}
+
+			if (flags & DC_EXEC) {
+				money -= ret.GetCost();
+				if (ret.GetCost() > 0 && money < 0) {
+					_additional_cash_required = ret.GetCost();
+					return cost;
+				}
+			}
+		}
+
+		if (flags & DC_EXEC) {
+			_cleared_object_areas.clear();
+			ret = DoCommandEx(item.tile, item.p1, item.p2, item.p3, item_flags, item.cmd);
+			if (ret.Failed()) {
+				last_error = ret;
+				continue;
+			}
+			if (skip_test) money -= ret.GetCost();
+		}
+		had_success = true;
+		cost.AddCost(ret);
+	}
+
+	return had_success ? cost : last_error;
+}
+
+/**
+ * Send a batch of landscape construction commands as #CMD_BATCH_COMMANDS commands.
+ * Batches larger than #MAX_COMMAND_BATCH_SIZE are split into multiple commands.
+ * @param items The commands to execute, in order. See #IsCommandBatchable for which commands are allowed.
+ * @param callback The callback to run for each batch as a whole.
+ * @param cmd_msg Error message for the batch as a whole, as #CMD_MSG, or 0 for no error message.
+ * @return true if any batch succeeded
+ */
+bool DoCommandPBatch(const std::vector<CommandBatchItem> &items, CommandCallback *callback, uint32_t cmd_msg)
+{
+	if (items.size() == 1) {
+		/* No need for the overhead of a batch */
+		const CommandBatchItem &item = items[0];
+		return DoCommandPEx(item.tile, item.p1, item.p2, item.p3, item.cmd | cmd_msg, callback);
+	}
+
+	bool result = false;
+	BatchCommandsCmdData data;
+	for (size_t offset = 0; offset < items.size(); offset += MAX_COMMAND_BATCH_SIZE) {
+		data.items.assign(items.begin() + offset, items.begin() + std::min<size_t>(offset + MAX_COMMAND_BATCH_SIZE, items.size()));
+		if (DoCommandPAux(0, &data, CMD_BATCH_COMMANDS | cmd_msg, callback)) result = true;
+	}
+	return result;
+}
+
 CommandCost::CommandCost(const CommandCost &other)
 {
 	*this = other;
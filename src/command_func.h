@@ -12,6 +12,7 @@
 
 #include "command_type.h"
 #include "company_type.h"
+#include <vector>
 
 /**
  * Define a default return value for a failed command.
@@ -66,6 +67,8 @@ inline bool DoCommandP(const CommandContainer *container, bool my_cmd = true)
 	return DoCommandPEx(container->tile, container->p1, container->p2, container->p3, container->cmd, container->callback, container->text.c_str(), container->aux_data.get(), my_cmd);
 }
 
+bool DoCommandPBatch(const std::vector<CommandBatchItem> &items, CommandCallback *callback = nullptr, uint32_t cmd_msg = 0);
+
 CommandCost DoCommandPScript(TileIndex tile, uint32_t p1, uint32_t p2, uint64_t p3, uint32_t cmd, CommandCallback *callback, const char *text, bool my_cmd, bool estimate_only, bool asynchronous, const CommandAuxiliaryBase *aux_data);
 CommandCost DoCommandPInternal(TileIndex tile, uint32_t p1, uint32_t p2, uint64_t p3, uint32_t cmd, CommandCallback *callback, const char *text, bool my_cmd, bool estimate_only, const CommandAuxiliaryBase *aux_data);
 
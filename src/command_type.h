@@ -536,6 +536,8 @@ enum Commands {
 
 	CMD_DESYNC_CHECK,                 ///< Force desync checks to be run
 
+	CMD_BATCH_COMMANDS,               ///< execute a batch of landscape construction commands as a single command
+
 	CMD_END,                          ///< Must ALWAYS be on the end of this list!! (period)
 };
 
@@ -783,6 +785,20 @@ struct CommandContainer {
 	CommandAuxiliaryPtr aux_data;    ///< Auxiliary command data
 };
 
+/**
+ * A single command of a #CMD_BATCH_COMMANDS batch.
+ */
+struct CommandBatchItem {
+	TileIndex tile;                  ///< tile command being executed on.
+	uint32_t p1;                     ///< parameter p1.
+	uint32_t p2;                     ///< parameter p2.
+	uint32_t cmd;                    ///< command being executed, without flags.
+	uint64_t p3;                     ///< parameter p3.
+};
+
+/** Maximum number of commands in a single #CMD_BATCH_COMMANDS batch, such that the batch fits in a single command packet. */
+static const uint MAX_COMMAND_BATCH_SIZE = 1024;
+
 inline CommandContainer NewCommandContainerBasic(TileIndex tile, uint32_t p1, uint32_t p2, uint32_t cmd, CommandCallback *callback = nullptr)
 {
 	return { tile, p1, p2, cmd, 0, callback, {}, nullptr };
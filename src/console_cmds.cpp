@@ -3014,6 +3014,10 @@ DEF_CONSOLE_CMD(ConDumpLoadDebugLog)
 
 	std::string dbgl = _loadgame_DBGL_data;
 	PrintLineByLine(dbgl.data());
+	if (!_loadgame_afterload_timings.empty()) {
+		std::string timings = _loadgame_afterload_timings;
+		PrintLineByLine(timings.data());
+	}
 	return true;
 }
 
@@ -3555,6 +3559,7 @@ DEF_CONSOLE_CMD(ConViewportDebug)
 		IConsolePrint(CC_HELP, "  10: VDF_SHOW_NO_LANDSCAPE_MAP_DRAW");
 		IConsolePrint(CC_HELP, "  20: VDF_DISABLE_LANDSCAPE_CACHE");
 		IConsolePrint(CC_HELP, "  40: VDF_DISABLE_THREAD");
+		IConsolePrint(CC_HELP, "  80: VDF_DISABLE_TILE_DRAW_CACHE");
 		return true;
 	}
 
@@ -3563,6 +3568,7 @@ DEF_CONSOLE_CMD(ConViewportDebug)
 		IConsolePrintF(CC_DEFAULT, "Viewport debug flags: %X", _viewport_debug_flags);
 	} else {
 		_viewport_debug_flags = std::strtoul(argv[1], nullptr, 16);
+		MarkWholeScreenDirty();
 	}
 
 	return true;
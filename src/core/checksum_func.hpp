@@ -26,21 +26,43 @@
 struct SimpleChecksum64 {
 	uint64_t state = 0;
 
+	static uint64_t Next(uint64_t state, uint64_t input)
+	{
+		return std::rotl(state, 1) ^ input ^ 0x123456789ABCDEF7ULL;
+	}
+
 	void Update(uint64_t input)
 	{
-		this->state = std::rotl(this->state, 1) ^ input ^ 0x123456789ABCDEF7ULL;
+		this->state = SimpleChecksum64::Next(this->state, input);
 	}
 };
 
+/**
+ * Game state subsystems which each have their own state checksum in addition to the overall state checksum.
+ * These are used to identify which part of the game state diverged when a desync is detected.
+ */
+enum StateChecksumSubsystem : uint8_t {
+	SCS_GENERAL,                      ///< Dates, tick counters and other miscellaneous state
+	SCS_VEHICLE,                      ///< Vehicle movement and pathfinding
+	SCS_STATION,                      ///< Station ratings and waiting cargo
+	SCS_CARGO,                        ///< Cargo delivery
+	SCS_MAP,                          ///< Map array contents, sampled by the tile loop
+	SCS_COMPANY,                      ///< Company finances, infrastructure and command costs
+	SCS_END,
+};
+
 extern SimpleChecksum64 _state_checksum;
+extern uint64_t _state_subsystem_checksums[SCS_END];
+
+const char *GetStateChecksumSubsystemName(StateChecksumSubsystem subsystem);
 
-inline void UpdateStateChecksum(uint64_t input)
+inline void UpdateStateChecksum(StateChecksumSubsystem subsystem, uint64_t input)
 {
-#if defined(DEDICATED)
-	_state_checksum.Update(input);
-#else
-	if (_networking) _state_checksum.Update(input);
+#if !defined(DEDICATED)
+	if (!_networking) return;
 #endif
+	_state_checksum.Update(input);
+	_state_subsystem_checksums[subsystem] = SimpleChecksum64::Next(_state_subsystem_checksums[subsystem], input);
 }
 
 #ifdef RANDOM_DEBUG
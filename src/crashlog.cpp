@@ -26,6 +26,7 @@
 #include "network/network.h"
 #include "network/network_survey.h"
 #include "network/network_sync.h"
+#include "core/checksum_func.hpp"
 #include "language.h"
 #include "fontcache.h"
 #include "news_gui.h"
@@ -707,6 +708,13 @@ char *CrashLog::FillDesyncCrashLog(char *buffer, const char *last, const DesyncE
 		buffer += seprintf(buffer, last, "Flags: %s%s\n",
 				flag_check(DesyncExtraInfo::DEIF_RAND, "R"),
 				flag_check(DesyncExtraInfo::DEIF_STATE, "S"));
+		if (info.state_subsystem_mismatches != 0) {
+			buffer += seprintf(buffer, last, "State mismatch in:");
+			for (uint i : SetBitIterator(info.state_subsystem_mismatches)) {
+				buffer += seprintf(buffer, last, " %s", GetStateChecksumSubsystemName((StateChecksumSubsystem)i));
+			}
+			buffer += seprintf(buffer, last, "\n");
+		}
 	}
 	if (_network_server && !info.desync_frame_info.empty()) {
 		buffer += seprintf(buffer, last, "%s\n", info.desync_frame_info.c_str());
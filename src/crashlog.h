@@ -26,6 +26,7 @@ struct DesyncExtraInfo {
 	};
 
 	Flags flags = DEIF_NONE;
+	uint32_t state_subsystem_mismatches = 0; ///< bit mask of StateChecksumSubsystem values with a state mismatch
 	const char *client_name = nullptr;
 	int client_id = -1;
 	std::string desync_frame_info;
@@ -73,6 +73,7 @@ const char *_savegame_DBGL_data = nullptr;
 std::string _loadgame_DBGL_data;
 bool _save_DBGC_data = false;
 std::string _loadgame_DBGC_data;
+std::string _loadgame_afterload_timings;
 
 uint32_t _misc_debug_flags;
 
@@ -60,6 +60,7 @@ extern const char *_savegame_DBGL_data;
 extern std::string _loadgame_DBGL_data;
 extern bool _save_DBGC_data;
 extern std::string _loadgame_DBGC_data;
+extern std::string _loadgame_afterload_timings;
 
 void CDECL debug(const char *dbg, int level, const char *format, ...) WARN_FORMAT(3, 4);
 void debug_print(const char *dbg, int level, const char *buf);
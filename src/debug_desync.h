@@ -19,6 +19,7 @@ enum CheckCachesFlags : uint32_t {
 	CHECK_CACHE_WATER_REGIONS      = 1 <<  2,
 	CHECK_CACHE_ALL                = UINT16_MAX,
 	CHECK_CACHE_EMIT_LOG           = 1 << 16,
+	CHECK_CACHE_INCREMENTAL        = 1 << 17, ///< Only check one step of the cache checks, selected by the tick counter
 };
 DECLARE_ENUM_AS_BIT_SET(CheckCachesFlags)
 
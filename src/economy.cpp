@@ -58,6 +58,7 @@
 #include "pathfinder/yapf/yapf_cache.h"
 #include "debug_desync.h"
 #include "event_logs.h"
+#include "core/checksum_func.hpp"
 #include "plans_func.h"
 
 #include "table/strings.h"
@@ -1168,13 +1169,11 @@ static SmallIndustryList _cargo_delivery_destinations;
 
 template <class F>
 void ForAcceptingIndustries(const Station *st, CargoID cargo_type, IndustryID source, CompanyID company, F&& f) {
-	for (const auto &i : st->industries_near) {
-		Industry *ind = i.industry;
+	for (const IndustryDeliveryEntry &entry : st->GetIndustryDeliveryList(cargo_type)) {
+		Industry *ind = entry.industry;
 		if (ind->index == source) continue;
 
-		int cargo_index = ind->GetCargoAcceptedIndex(cargo_type);
-		/* Check if matching cargo has been found */
-		if (cargo_index < 0) continue;
+		uint cargo_index = entry.cargo_index;
 
 		/* Check if industry temporarily refuses acceptance */
 		if (IndustryTemporarilyRefusesCargo(ind, cargo_type)) continue;
@@ -1361,6 +1360,9 @@ static Money DeliverGoods(int num_pieces, CargoID cargo_type, StationID dest, ui
 		SetBit(st->goods[cargo_type].status, GoodsEntry::GES_ACCEPTED_BIGTICK);
 	}
 
+	DEBUG_UPDATESTATECHECKSUM("DeliverGoods: st: %u, cargo: %u, pieces: %d, accepted: %u", dest, cargo_type, num_pieces, accepted_total);
+	UpdateStateChecksum(SCS_CARGO, (((uint64_t) dest) << 32) | (cargo_type << 24) | accepted_total);
+
 	/* Update company statistics */
 	company->cur_economy.delivered_cargo[cargo_type] += accepted_total;
 
@@ -35,6 +35,7 @@
 static std::mutex _sound_perf_lock;
 static std::atomic<bool> _sound_perf_pending;
 static std::vector<TimingMeasurement> _sound_perf_measurements;
+static uint64_t _gameloop_overruns = 0;
 
 /**
  * Private declarations for performance measurement implementation
@@ -68,6 +69,9 @@ namespace {
 		/** Start time for current accumulation cycle */
 		TimingMeasurement acc_timestamp;
 
+		/** Running totals of all recorded measurements, not affected by the circular buffer */
+		PerformanceElementTotals totals{};
+
 		/**
 		 * Initialize a data element with an expected collection rate
 		 * @param expected_rate
@@ -81,6 +85,8 @@ namespace {
 		{
 			this->durations[this->next_index] = end_time - start_time;
 			this->timestamps[this->next_index] = start_time;
+			this->totals.duration += end_time - start_time;
+			this->totals.count++;
 			this->prev_index = this->next_index;
 			this->next_index += 1;
 			if (this->next_index >= NUM_FRAMERATE_POINTS) this->next_index = 0;
@@ -92,6 +98,8 @@ namespace {
 		{
 			this->timestamps[this->next_index] = this->acc_timestamp;
 			this->durations[this->next_index] = this->acc_duration;
+			this->totals.duration += this->acc_duration;
+			this->totals.count++;
 			this->prev_index = this->next_index;
 			this->next_index += 1;
 			if (this->next_index >= NUM_FRAMERATE_POINTS) this->next_index = 0;
@@ -265,7 +273,28 @@ PerformanceMeasurer::~PerformanceMeasurer()
 		_sound_perf_pending.store(true, std::memory_order_release);
 		return;
 	}
-	_pf_data[this->elem].Add(this->start_time, GetPerformanceTimer());
+	TimingMeasurement end = GetPerformanceTimer();
+	if (this->elem == PFE_GAMELOOP && (end - this->start_time) * _ticks_per_second > TIMESTAMP_PRECISION) _gameloop_overruns++;
+	_pf_data[this->elem].Add(this->start_time, end);
+}
+
+/**
+ * Get the running totals of a performance element, these only ever increase.
+ * @param elem The element to get the totals of
+ * @return The totals
+ */
+PerformanceElementTotals GetPerformanceElementTotals(PerformanceElement elem)
+{
+	return _pf_data[elem].totals;
+}
+
+/**
+ * Get the number of game loops which took longer than the tick interval.
+ * @return The number of overrunning game loops since startup
+ */
+uint64_t GetGameLoopOverrunCount()
+{
+	return _gameloop_overruns;
 }
 
 /** Set the rate of expected cycles per second of a performance element. */
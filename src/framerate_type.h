@@ -123,4 +123,13 @@ public:
 void ShowFramerateWindow();
 void ProcessPendingPerformanceMeasurements();
 
+/** Running totals of a performance element. */
+struct PerformanceElementTotals {
+	TimingMeasurement duration; ///< Total time spent in the element, in microseconds
+	uint64_t count;             ///< Total number of recorded measurements
+};
+
+PerformanceElementTotals GetPerformanceElementTotals(PerformanceElement elem);
+uint64_t GetGameLoopOverrunCount();
+
 #endif /* FRAMERATE_TYPE_H */
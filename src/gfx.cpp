@@ -1937,6 +1937,7 @@ void SetPendingDirtyBlocks(int left, int top, int right, int bottom)
 void MarkWholeScreenDirty()
 {
 	_whole_screen_dirty = true;
+	ClearTileDrawCache();
 }
 
 /**
@@ -17,6 +17,7 @@
 #include "engine_type.h"
 #include "livery.h"
 #include "3rdparty/cpp-btree/btree_map.h"
+#include "3rdparty/cpp-btree/btree_set.h"
 #include <string>
 
 typedef Pool<Group, GroupID, 16, 64000> GroupPool;
@@ -27,6 +28,7 @@ struct GroupStatistics {
 	Money profit_last_year;                 ///< Sum of profits for all vehicles.
 	Money profit_last_year_min_age;         ///< Sum of profits for vehicles considered for profit statistics.
 	btree::btree_map<EngineID, uint16_t> num_engines; ///< Caches the number of engines of each type the company owns.
+	btree::btree_set<VehicleID> vehicles;   ///< Index of the primary vehicles in the group.
 	uint16_t num_vehicle;                   ///< Number of vehicles.
 	uint16_t num_vehicle_min_age;           ///< Number of vehicles considered for profit statistics;
 	bool autoreplace_defined;               ///< Are any autoreplace rules set?
@@ -62,6 +64,7 @@ struct GroupStatistics {
 	static void UpdateProfits();
 	static void UpdateAfterLoad();
 	static void UpdateAutoreplace(CompanyID company);
+	static bool ValidateVehicleIndex();
 };
 
 enum GroupFlags : uint8_t {
@@ -41,6 +41,7 @@ INSTANTIATE_POOL_METHODS(Group)
 void GroupStatistics::Clear()
 {
 	this->num_vehicle = 0;
+	this->vehicles.clear();
 	this->profit_last_year = 0;
 	this->num_vehicle_min_age = 0;
 	this->profit_last_year_min_age = 0;
@@ -153,6 +154,14 @@ uint16_t GroupStatistics::GetNumEngines(EngineID engine) const
 	stats.num_vehicle += delta;
 	stats.profit_last_year += v->GetDisplayProfitLastYear() * delta;
 
+	if (delta > 0) {
+		stats_all.vehicles.insert(v->index);
+		stats.vehicles.insert(v->index);
+	} else {
+		stats_all.vehicles.erase(v->index);
+		stats.vehicles.erase(v->index);
+	}
+
 	if (v->economy_age > VEHICLE_PROFIT_MIN_AGE) {
 		stats_all.num_vehicle_min_age += delta;
 		stats_all.profit_last_year_min_age += v->GetDisplayProfitLastYear() * delta;
@@ -161,6 +170,36 @@ uint16_t GroupStatistics::GetNumEngines(EngineID engine) const
 	}
 }
 
+/**
+ * Check that the per-group primary vehicle indexes match the vehicle pool.
+ * @return true if the indexes are valid.
+ */
+/* static */ bool GroupStatistics::ValidateVehicleIndex()
+{
+	size_t count = 0;
+	for (const Vehicle *v : Vehicle::IterateFrontOnly()) {
+		if (!v->IsEngineCountable() || !v->IsPrimaryVehicle()) continue;
+
+		if (GroupStatistics::Get(v).vehicles.count(v->index) == 0) return false;
+		if (GroupStatistics::GetAllGroup(v).vehicles.count(v->index) == 0) return false;
+		count++;
+	}
+
+	size_t all_count = 0;
+	size_t group_count = 0;
+	for (const Company *c : Company::Iterate()) {
+		for (VehicleType type = VEH_BEGIN; type < VEH_COMPANY_END; type++) {
+			all_count += c->group_all[type].vehicles.size();
+			group_count += c->group_default[type].vehicles.size();
+		}
+	}
+	for (const Group *g : Group::Iterate()) {
+		group_count += g->statistics.vehicles.size();
+	}
+
+	return all_count == count && group_count == count;
+}
+
 /**
  * Update num_engines when adding/removing an engine.
  * @param v Engine to count.
@@ -1809,6 +1809,7 @@ static void PopulateStationsNearby(Industry *ind)
 		ind->stations_near.insert(ind->neutral_station);
 		ind->neutral_station->industries_near.clear();
 		ind->neutral_station->industries_near.insert(IndustryListEntry{0, ind});
+		ind->neutral_station->InvalidateIndustryDeliveryCache();
 		return;
 	}
 
@@ -37,6 +37,8 @@
 #include "scope_info.h"
 #include "core/ring_buffer.hpp"
 #include "network/network_sync.h"
+#include "network/network.h"
+#include "core/checksum_func.hpp"
 #include <array>
 #include <list>
 #include <set>
@@ -742,6 +744,19 @@ void SetupTileLoopCounts()
 	if (accumulator > 0) _tile_loop_counts[0]++;
 }
 
+/**
+ * Update the map state checksum with the contents of a tile, such that the whole map is sampled by each pass of the tile loop.
+ * @param tile The tile to sample.
+ */
+static inline void UpdateTileStateChecksum(TileIndex tile)
+{
+	uint64_t m;
+	memcpy(&m, &_m[tile], sizeof(m));
+	uint32_t me;
+	memcpy(&me, &_me[tile], sizeof(me));
+	UpdateStateChecksum(SCS_MAP, m ^ (((uint64_t) me) << 16));
+}
+
 /**
  * Gradually iterate over all tiles on the map, calling their TileLoopProcs once every 256 ticks.
  */
@@ -780,6 +795,7 @@ void RunTileLoop(bool apply_day_length)
 		}
 
 		_tile_type_procs[GetTileType(tile)]->tile_loop_proc(tile);
+		UpdateTileStateChecksum(tile);
 
 		tile = next;
 	}
@@ -31,23 +31,9 @@
 
 	CargoTypes have_cargo_mask = v->GetLastLoadingStationValidCargoMask();
 
-	/* Scan orders for cargo-specific load/unload, and run LinkRefresher separately for each set of cargoes where they differ. */
 	while (cargo_mask != 0) {
-		CargoTypes iter_cargo_mask = cargo_mask;
-		for (const Order *o = v->orders->GetFirstOrder(); o != nullptr; o = o->next) {
-			if (o->IsType(OT_GOTO_STATION) || o->IsType(OT_IMPLICIT)) {
-				if (o->GetUnloadType() == OUFB_CARGO_TYPE_UNLOAD) {
-					CargoMaskValueFilter<uint>(iter_cargo_mask, [&](CargoID cargo) -> uint {
-						return o->GetCargoUnloadType(cargo) & (OUFB_TRANSFER | OUFB_UNLOAD | OUFB_NO_UNLOAD);
-					});
-				}
-				if (o->GetLoadType() == OLFB_CARGO_TYPE_LOAD) {
-					CargoMaskValueFilter<uint>(iter_cargo_mask, [&](CargoID cargo) -> uint {
-						return o->GetCargoLoadType(cargo) & (OLFB_NO_LOAD);
-					});
-				}
-			}
-		}
+		/* Run LinkRefresher separately for each set of cargoes where the cargo-specific load/unload orders differ. */
+		CargoTypes iter_cargo_mask = v->orders->GetCargoLoadUnloadGroup(cargo_mask);
 
 		/* Make sure the first order is a useful order. */
 		const Order *first = v->orders->GetNextDecisionNode(v->GetOrder(v->cur_implicit_order_index), 0, iter_cargo_mask);
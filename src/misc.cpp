@@ -43,6 +43,7 @@
 #include "string_func.h"
 #include "plans_func.h"
 #include "core/format.hpp"
+#include "core/checksum_func.hpp"
 #include "3rdparty/monocypher/monocypher.h"
 
 #include "safeguards.h"
@@ -137,6 +138,7 @@ void InitializeGame(uint size_x, uint size_y, bool reset_date, bool reset_settin
 	_aux_tileloop_tile = 1;
 	_thd.redsq = INVALID_TILE;
 	_road_layout_change_counter = 0;
+	std::fill(std::begin(_state_subsystem_checksums), std::end(_state_subsystem_checksums), 0);
 	_loaded_local_company = COMPANY_SPECTATOR;
 	_game_events_since_load = (GameEventFlags) 0;
 	_game_events_overall = (GameEventFlags) 0;
@@ -81,6 +81,8 @@ public:
 		}
 	}
 
+	bool IsEncryptionPending() const { return this->encyption_pending; }
+
 	/* Sending/writing of packets */
 	inline void PrepareToSend()
 	{
@@ -115,6 +117,17 @@ public:
 
 	const uint8_t *GetBufferData() const { return this->buffer.data(); }
 	PacketSize GetRawPos() const { return this->pos; }
+
+	/**
+	 * Advance the transfer position, after bytes have been sent other than by TransferOut.
+	 * @param bytes The number of bytes which were sent.
+	 */
+	void AdvanceTransferPosition(size_t bytes)
+	{
+		assert(bytes <= this->RemainingBytesToTransfer());
+		this->pos += static_cast<PacketSize>(bytes);
+	}
+
 	void ReserveBuffer(size_t size) { this->buffer.reserve(size); }
 
 	/**
@@ -14,6 +14,17 @@
 
 #include "tcp.h"
 
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/epoll.h>
+#endif
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+/** Send the queued packets of a connection using a single gathering write. */
+#define WITH_TCP_GATHER_SEND
+#include <sys/uio.h>
+#endif
+
 #include "../../safeguards.h"
 
 /**
@@ -38,6 +49,7 @@ NetworkTCPSocketHandler::~NetworkTCPSocketHandler()
  */
 void NetworkTCPSocketHandler::CloseSocket()
 {
+	if (this->poller != nullptr) this->poller->Remove(this);
 	if (this->sock != INVALID_SOCKET) closesocket(this->sock);
 	this->sock = INVALID_SOCKET;
 }
@@ -86,10 +98,17 @@ void NetworkTCPSocketHandler::SendPrependPacket(std::unique_ptr<Packet> packet,
 
 	packet->PrepareForSendQueue();
 
+	/* Packets which have already been encrypted must be sent in the order in which they were encrypted,
+	 * SendPackets may encrypt several packets at the front of the queue in one go. */
+	auto is_encrypted = [&](const std::unique_ptr<Packet> &queued) -> bool {
+		return this->send_encryption_handler != nullptr && !queued->IsEncryptionPending();
+	};
+
 	if (queue_after_packet_type >= 0) {
 		for (auto iter = this->packet_queue.begin(); iter != this->packet_queue.end(); ++iter) {
 			if ((*iter)->GetTransmitPacketType() == queue_after_packet_type) {
 				++iter;
+				while (iter != this->packet_queue.end() && is_encrypted(*iter)) ++iter;
 				this->packet_queue.insert(iter, std::move(packet));
 				return;
 			}
@@ -97,10 +116,12 @@ void NetworkTCPSocketHandler::SendPrependPacket(std::unique_ptr<Packet> packet,
 	}
 
 	/* The very first packet in the queue may be partially written out, so cannot be replaced.
-	 * If the queue is non-empty, swap packet with the first packet in the queue.
-	 * The insert the packet (either the incoming packet or the previous first packet) at the front. */
+	 * If the queue is non-empty, insert the packet after the first packet in the queue, and after any other encrypted packets. */
 	if (!this->packet_queue.empty()) {
-		packet.swap(this->packet_queue.front());
+		auto iter = std::next(this->packet_queue.begin());
+		while (iter != this->packet_queue.end() && is_encrypted(*iter)) ++iter;
+		this->packet_queue.insert(iter, std::move(packet));
+		return;
 	}
 	this->packet_queue.push_front(std::move(packet));
 }
@@ -130,9 +151,25 @@ SendPacketsState NetworkTCPSocketHandler::SendPackets(bool closing_down)
 	if (!this->IsConnected()) return SPS_CLOSED;
 
 	while (!this->packet_queue.empty()) {
+#ifdef WITH_TCP_GATHER_SEND
+		/* Write as many queued packets as possible with a single system call */
+		std::array<iovec, 64> iov;
+		size_t iov_count = 0;
+		size_t iov_bytes = 0;
+		for (const std::unique_ptr<Packet> &queued : this->packet_queue) {
+			if (iov_count == iov.size()) break;
+			queued->CheckPendingPreSendEncryption();
+			iov[iov_count].iov_base = const_cast<uint8_t *>(queued->GetBufferData() + queued->GetRawPos());
+			iov[iov_count].iov_len = queued->RemainingBytesToTransfer();
+			iov_bytes += iov[iov_count].iov_len;
+			iov_count++;
+		}
+		ssize_t res = writev(this->sock, iov.data(), (int)iov_count);
+#else
 		Packet &p = *this->packet_queue.front();
 		p.CheckPendingPreSendEncryption();
 		ssize_t res = p.TransferOut<int>(send, this->sock, 0);
+#endif
 		if (res == -1) {
 			NetworkError err = NetworkError::GetLast();
 			if (!err.WouldBlock()) {
@@ -143,6 +180,7 @@ SendPacketsState NetworkTCPSocketHandler::SendPackets(bool closing_down)
 				}
 				return SPS_CLOSED;
 			}
+			this->SetNotWritable();
 			return SPS_PARTLY_SENT;
 		}
 		if (res == 0) {
@@ -151,19 +189,49 @@ SendPacketsState NetworkTCPSocketHandler::SendPackets(bool closing_down)
 			return SPS_CLOSED;
 		}
 
+#ifdef WITH_TCP_GATHER_SEND
+		/* Remove the packets which have been sent completely */
+		for (size_t sent = res; sent > 0;) {
+			Packet &p = *this->packet_queue.front();
+			size_t amount = std::min(sent, p.RemainingBytesToTransfer());
+			p.AdvanceTransferPosition(amount);
+			sent -= amount;
+			if (p.RemainingBytesToTransfer() == 0) {
+				if (_debug_net_level >= 5) this->LogSentPacket(p);
+				this->packet_queue.pop_front();
+			}
+		}
+		if (static_cast<size_t>(res) < iov_bytes) {
+			/* The socket send buffer is full */
+			this->SetNotWritable();
+			return SPS_PARTLY_SENT;
+		}
+#else
 		/* Is this packet sent? */
 		if (p.RemainingBytesToTransfer() == 0) {
 			/* Go to the next packet */
 			if (_debug_net_level >= 5) this->LogSentPacket(p);
 			this->packet_queue.pop_front();
 		} else {
+			/* The socket send buffer is full */
+			this->SetNotWritable();
 			return SPS_PARTLY_SENT;
 		}
+#endif
 	}
 
 	return SPS_ALL_SENT;
 }
 
+/**
+ * Mark that sending to this socket would block, if the socket is registered with a poller it then waits for the socket to become writable.
+ */
+void NetworkTCPSocketHandler::SetNotWritable()
+{
+	this->writable = false;
+	if (this->poller != nullptr) this->poller->SetPollWritable(this, true);
+}
+
 /**
  * Receives a packet for the given client
  * @return The received packet (or nullptr when it didn't receive one)
@@ -250,6 +318,16 @@ bool NetworkTCPSocketHandler::CanSendReceive()
 {
 	assert(this->sock != INVALID_SOCKET);
 
+#if defined(__linux__)
+	/* poll is not limited to socket numbers below FD_SETSIZE */
+	pollfd pfd{};
+	pfd.fd = this->sock;
+	pfd.events = POLLIN | POLLOUT;
+	if (poll(&pfd, 1, 0) < 0) return false;
+
+	this->writable = (pfd.revents & POLLOUT) != 0;
+	return (pfd.revents & (POLLIN | POLLHUP | POLLERR)) != 0;
+#else
 	fd_set read_fd, write_fd;
 	struct timeval tv;
 
@@ -264,4 +342,147 @@ bool NetworkTCPSocketHandler::CanSendReceive()
 
 	this->writable = !!FD_ISSET(this->sock, &write_fd);
 	return FD_ISSET(this->sock, &read_fd) != 0;
+#endif
+}
+
+/**
+ * Start the poller.
+ * @return true if the poller is active, false if select() has to be used instead.
+ */
+bool NetworkTCPSocketPoller::Start()
+{
+#if defined(__linux__)
+	if (this->epoll_fd < 0) {
+		this->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+		if (this->epoll_fd < 0) DEBUG(net, 0, "epoll_create1 failed, using select: %s", NetworkError::GetLast().AsString());
+	}
+#endif
+	return this->IsActive();
+}
+
+/** Stop the poller, sockets which are still registered are polled using select() from now on. */
+void NetworkTCPSocketPoller::Stop()
+{
+#if defined(__linux__)
+	if (this->epoll_fd >= 0) close(this->epoll_fd);
+	this->epoll_fd = -1;
+#endif
+}
+
+/**
+ * Whether the poller is active.
+ * @return true if sockets are registered with the poller, false if select() has to be used instead.
+ */
+bool NetworkTCPSocketPoller::IsActive() const
+{
+#if defined(__linux__)
+	return this->epoll_fd >= 0;
+#else
+	return false;
+#endif
+}
+
+/**
+ * Register a listening socket, its events are reported with #LISTENER_TAG.
+ * @param s The socket.
+ */
+void NetworkTCPSocketPoller::AddListener([[maybe_unused]] SOCKET s)
+{
+#if defined(__linux__)
+	if (!this->IsActive()) return;
+
+	epoll_event event{};
+	event.events = EPOLLIN;
+	event.data.u64 = LISTENER_TAG;
+	if (epoll_ctl(this->epoll_fd, EPOLL_CTL_ADD, s, &event) < 0) DEBUG(net, 0, "epoll_ctl failed: %s", NetworkError::GetLast().AsString());
+#endif
+}
+
+/**
+ * Register the socket of a connection, until it is closed.
+ * The tag should identify the connection, events of a connection which has been removed may still be reported in the same Poll() call.
+ * @param handler The connection.
+ * @param tag Tag of the events of the socket.
+ */
+void NetworkTCPSocketPoller::Add(NetworkTCPSocketHandler *handler, uint64_t tag)
+{
+	assert(tag != LISTENER_TAG);
+#if defined(__linux__)
+	if (!this->IsActive() || handler->poller != nullptr || !handler->IsConnected()) return;
+
+	/* Wait for the socket to become writable for the first time */
+	epoll_event event{};
+	event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP;
+	event.data.u64 = tag;
+	if (epoll_ctl(this->epoll_fd, EPOLL_CTL_ADD, handler->sock, &event) < 0) {
+		DEBUG(net, 0, "epoll_ctl failed: %s", NetworkError::GetLast().AsString());
+		return;
+	}
+	handler->poller = this;
+	handler->poll_tag = tag;
+	handler->poll_writable = true;
+#endif
+}
+
+/**
+ * Unregister the socket of a connection.
+ * This has to be done before closing the socket, as the socket may have been inherited by a child process.
+ * @param handler The connection.
+ */
+void NetworkTCPSocketPoller::Remove(NetworkTCPSocketHandler *handler)
+{
+	assert(handler->poller == this);
+#if defined(__linux__)
+	if (this->IsActive() && handler->IsConnected()) epoll_ctl(this->epoll_fd, EPOLL_CTL_DEL, handler->sock, nullptr);
+#endif
+	handler->poller = nullptr;
+	handler->poll_writable = false;
+}
+
+/**
+ * Set whether to wait for the socket of a connection to become writable.
+ * @param handler The connection.
+ * @param poll_writable Whether to report the socket when it is writable.
+ */
+void NetworkTCPSocketPoller::SetPollWritable(NetworkTCPSocketHandler *handler, bool poll_writable)
+{
+	assert(handler->poller == this);
+	if (handler->poll_writable == poll_writable) return;
+	handler->poll_writable = poll_writable;
+#if defined(__linux__)
+	if (!this->IsActive() || !handler->IsConnected()) return;
+
+	epoll_event event{};
+	event.events = EPOLLIN | EPOLLRDHUP | (poll_writable ? (uint32_t)EPOLLOUT : 0);
+	event.data.u64 = handler->poll_tag;
+	if (epoll_ctl(this->epoll_fd, EPOLL_CTL_MOD, handler->sock, &event) < 0) DEBUG(net, 0, "epoll_ctl failed: %s", NetworkError::GetLast().AsString());
+#endif
+}
+
+/**
+ * Report all registered sockets which are ready, without blocking.
+ * @param proc Function to call for each socket which is ready.
+ * @return false if polling failed.
+ */
+bool NetworkTCPSocketPoller::Poll([[maybe_unused]] const ReadyProc &proc)
+{
+#if defined(__linux__)
+	if (!this->IsActive()) return false;
+
+	/* Events are level triggered, so when there are more ready sockets than fit in the buffer, the rest are reported by the next call */
+	std::array<epoll_event, 64> events;
+	int count;
+	do {
+		count = epoll_wait(this->epoll_fd, events.data(), (int)events.size(), 0);
+	} while (count < 0 && errno == EINTR);
+	if (count < 0) return false;
+
+	for (int i = 0; i < count; i++) {
+		const uint32_t flags = events[i].events;
+		proc(events[i].data.u64, (flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0, (flags & EPOLLOUT) != 0);
+	}
+	return true;
+#else
+	return false;
+#endif
 }
@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -31,6 +32,8 @@ enum SendPacketsState {
 	SPS_ALL_SENT,    ///< All packets in the queue are sent.
 };
 
+class NetworkTCPSocketPoller;
+
 /** Base socket handler for all TCP sockets */
 class NetworkTCPSocketHandler : public NetworkSocketHandler {
 private:
@@ -41,6 +44,10 @@ public:
 	SOCKET sock;              ///< The socket currently connected to
 	bool writable;            ///< Can we write to this socket?
 
+	NetworkTCPSocketPoller *poller = nullptr; ///< Poller the socket is registered with, if any.
+	uint64_t poll_tag = 0;                    ///< Tag of the events of this socket in #poller.
+	bool poll_writable = false;               ///< Whether #poller waits for the socket to become writable.
+
 	/**
 	 * Whether this socket is currently bound to a socket.
 	 * @return true when the socket is bound, false otherwise
@@ -55,6 +62,7 @@ public:
 	void ShrinkToFitSendQueue();
 
 	SendPacketsState SendPackets(bool closing_down = false);
+	void SetNotWritable();
 
 	virtual std::unique_ptr<Packet> ReceivePacket();
 	virtual void LogSentPacket(const Packet &pkt);
@@ -71,6 +79,38 @@ public:
 	~NetworkTCPSocketHandler();
 };
 
+/**
+ * Readiness notification for the sockets of a TCP server.
+ * On Linux this uses epoll: sockets stay registered until they are closed, and only sockets which are ready are reported,
+ * so the cost of polling does not depend on the number of idle connections.
+ * Elsewhere, or when epoll is not available, IsActive() returns false and the caller uses select() instead.
+ * A registered socket is only polled for writability after sending to it would have blocked, #NetworkTCPSocketHandler::writable stays set otherwise.
+ */
+class NetworkTCPSocketPoller {
+#if defined(__linux__)
+	int epoll_fd = -1; ///< The epoll instance.
+#endif
+
+public:
+	/** Tag of the events of listening sockets. */
+	static constexpr uint64_t LISTENER_TAG = UINT64_MAX;
+
+	/** Function called for each socket which is ready, with its tag and whether it is readable and/or writable. */
+	using ReadyProc = std::function<void(uint64_t tag, bool readable, bool writable)>;
+
+	bool Start();
+	void Stop();
+	bool IsActive() const;
+
+	void AddListener(SOCKET s);
+	void Add(NetworkTCPSocketHandler *handler, uint64_t tag);
+	void Remove(NetworkTCPSocketHandler *handler);
+	void SetPollWritable(NetworkTCPSocketHandler *handler, bool poll_writable);
+	bool Poll(const ReadyProc &proc);
+
+	~NetworkTCPSocketPoller() { this->Stop(); }
+};
+
 /**
  * "Helper" class for creating TCP connections in a non-blocking manner
  */
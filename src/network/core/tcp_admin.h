@@ -61,6 +61,9 @@ enum PacketAdminType : uint8_t {
 	ADMIN_PACKET_SERVER_RCON_END,        ///< The server indicates that the remote console command has completed.
 	ADMIN_PACKET_SERVER_PONG,            ///< The server replies to a ping request from the admin.
 
+	/* Packets specific to this version, numbered such that they do not clash with packets added by upstream OpenTTD. */
+	ADMIN_PACKET_SERVER_PERFORMANCE = 200, ///< The server gives the admin a sample of its performance.
+
 	INVALID_ADMIN_PACKET = 0xFF,         ///< An invalid marker for admin packets.
 };
 
@@ -83,6 +86,10 @@ enum AdminUpdateType {
 	ADMIN_UPDATE_CMD_NAMES,       ///< The admin would like a list of all DoCommand names.
 	ADMIN_UPDATE_CMD_LOGGING,     ///< The admin would like to have DoCommand information.
 	ADMIN_UPDATE_GAMESCRIPT,      ///< The admin would like to have gamescript messages.
+	ADMIN_UPDATE_UPSTREAM_END,    ///< End of the update types shared with upstream OpenTTD.
+
+	/* Update types specific to this version, numbered such that they do not clash with update types added by upstream OpenTTD. */
+	ADMIN_UPDATE_PERFORMANCE = 32, ///< The admin would like to have server performance samples.
 	ADMIN_UPDATE_END,             ///< Must ALWAYS be on the end of this list!! (period)
 };
 
@@ -98,6 +105,20 @@ enum AdminUpdateFrequency {
 };
 DECLARE_ENUM_AS_BIT_SET(AdminUpdateFrequency)
 
+/** Pools reported in #ADMIN_PACKET_SERVER_PERFORMANCE. */
+enum AdminPerformancePool : uint8_t {
+	ADMIN_PERF_POOL_VEHICLE,      ///< Vehicles.
+	ADMIN_PERF_POOL_CARGO_PACKET, ///< Cargo packets.
+	ADMIN_PERF_POOL_ORDER,        ///< Orders.
+	ADMIN_PERF_POOL_ORDER_LIST,   ///< Order lists.
+	ADMIN_PERF_POOL_STATION,      ///< Stations and waypoints.
+	ADMIN_PERF_POOL_TOWN,         ///< Towns.
+	ADMIN_PERF_POOL_INDUSTRY,     ///< Industries.
+	ADMIN_PERF_POOL_LINK_GRAPH,   ///< Link graphs.
+
+	ADMIN_PERF_POOL_END,          ///< Sentinel for end.
+};
+
 /** Reasons for removing a company - communicated to admins. */
 enum AdminCompanyRemoveReason {
 	ADMIN_CRR_MANUAL,    ///< The company is manually removed.
@@ -489,6 +510,25 @@ protected:
 	 */
 	virtual NetworkRecvStatus Receive_SERVER_RCON_END(Packet &p);
 
+	/**
+	 * Send a sample of the server's performance, covering the period since the previous sample.
+	 * uint64_t  State tick counter at the time of the sample.
+	 * uint16_t  Number of ticks covered by the sample.
+	 * uint32_t  Number of game loops which took longer than the tick interval during the sample.
+	 * uint8_t   Number of performance elements which follow, in #PerformanceElement order.
+	 * For each performance element:
+	 * uint32_t  Microseconds spent in the element during the sample.
+	 * uint32_t  Number of measurements of the element during the sample.
+	 * uint8_t   Number of pools which follow.
+	 * For each pool:
+	 * uint8_t   Pool, see #AdminPerformancePool.
+	 * uint32_t  Number of items in the pool.
+	 * uint64_t  Approximate memory used by the pool, in bytes.
+	 * @param p The packet that was just received.
+	 * @return The state the network should have.
+	 */
+	virtual NetworkRecvStatus Receive_SERVER_PERFORMANCE(Packet &p);
+
 	NetworkRecvStatus HandlePacket(Packet &p);
 public:
 	NetworkRecvStatus CloseConnection(bool error = true) override;
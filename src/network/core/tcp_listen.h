@@ -28,6 +28,8 @@ template <class Tsocket, PacketType Tfull_packet, PacketType Tban_packet>
 class TCPListenHandler {
 	/** List of sockets we listen on. */
 	static SocketList sockets;
+	/** Poller for the listening sockets and the connections, if available. */
+	static NetworkTCPSocketPoller socket_poller;
 
 public:
 	static bool ValidateClient(SOCKET s, NetworkAddress &address)
@@ -91,6 +93,16 @@ public:
 
 			if (!Tsocket::ValidateClient(s, address)) continue;
 			Tsocket::AcceptConnection(s, address);
+
+			if (socket_poller.IsActive()) {
+				/* Find the connection which has just been created, if it was accepted */
+				for (Tsocket *cs : Tsocket::Iterate()) {
+					if (cs->sock == s) {
+						socket_poller.Add(cs, cs->index);
+						break;
+					}
+				}
+			}
 		}
 	}
 
@@ -100,6 +112,28 @@ public:
 	 */
 	static bool Receive()
 	{
+		if (socket_poller.IsActive()) {
+			if (!socket_poller.Poll([](uint64_t tag, bool readable, bool writable) {
+				if (tag == NetworkTCPSocketPoller::LISTENER_TAG) {
+					for (auto &s : sockets) AcceptClient(s.first);
+					return;
+				}
+
+				/* The connection may have been closed while handling an earlier event */
+				Tsocket *cs = Tsocket::GetIfValid(static_cast<size_t>(tag));
+				if (cs == nullptr || cs->poller != &socket_poller) return;
+
+				if (writable) {
+					cs->writable = true;
+					socket_poller.SetPollWritable(cs, false);
+				}
+				if (readable) cs->ReceivePackets();
+			})) {
+				return false;
+			}
+			return _networking;
+		}
+
 		fd_set read_fd, write_fd;
 		struct timeval tv;
 
@@ -157,6 +191,10 @@ public:
 			return false;
 		}
 
+		if (socket_poller.Start()) {
+			for (auto &s : sockets) socket_poller.AddListener(s.first);
+		}
+
 		return true;
 	}
 
@@ -167,10 +205,12 @@ public:
 			closesocket(s.first);
 		}
 		sockets.clear();
+		socket_poller.Stop();
 		DEBUG(net, 5, "[%s] Closed listeners", Tsocket::GetName());
 	}
 };
 
 template <class Tsocket, PacketType Tfull_packet, PacketType Tban_packet> SocketList TCPListenHandler<Tsocket, Tfull_packet, Tban_packet>::sockets;
+template <class Tsocket, PacketType Tfull_packet, PacketType Tban_packet> NetworkTCPSocketPoller TCPListenHandler<Tsocket, Tfull_packet, Tban_packet>::socket_poller;
 
 #endif /* NETWORK_CORE_TCP_LISTEN_H */
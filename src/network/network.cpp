@@ -90,6 +90,7 @@ uint32_t _last_sync_frame;                              ///< Used in the server
 NetworkAddressList _broadcast_list;                     ///< List of broadcast addresses.
 uint32_t _sync_seed_1;                                  ///< Seed to compare during sync checks.
 uint64_t _sync_state_checksum;                          ///< State checksum to compare during sync checks.
+uint64_t _sync_state_subsystem_checksums[SCS_END];     ///< Per-subsystem state checksums to compare during sync checks.
 uint32_t _sync_frame;                                   ///< The frame to perform the sync check.
 EconTime::Date   _last_sync_date;                       ///< The game date of the last successfully received sync frame
 EconTime::DateFract _last_sync_date_fract;              ///< "
@@ -1426,6 +1427,7 @@ void NetworkGameLoop()
 
 		_sync_seed_1 = _random.state[0];
 		_sync_state_checksum = _state_checksum.state;
+		std::copy(std::begin(_state_subsystem_checksums), std::end(_state_subsystem_checksums), std::begin(_sync_state_subsystem_checksums));
 
 		_network_sync_records.push_back({ NSRE_FRAME_DONE, _random.state[0], _state_checksum.state });
 		_network_sync_record_counts.push_back((uint)(_network_sync_records.size() - total_sync_records));
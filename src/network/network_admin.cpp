@@ -21,6 +21,15 @@
 #include "../map_func.h"
 #include "../rev.h"
 #include "../game/game.hpp"
+#include "../framerate_type.h"
+#include "../vehicle_base.h"
+#include "../cargopacket.h"
+#include "../order_base.h"
+#include "../base_station_base.h"
+#include "../town.h"
+#include "../industry.h"
+#include "../linkgraph/linkgraph.h"
+#include "../settings_type.h"
 
 #include <numeric>
 
@@ -57,7 +66,22 @@ static const AdminUpdateFrequency _admin_update_type_frequencies[] = {
 	                       ADMIN_FREQUENCY_AUTOMATIC,                                                                                                      ///< ADMIN_UPDATE_GAMESCRIPT
 };
 /** Sanity check. */
-static_assert(lengthof(_admin_update_type_frequencies) == ADMIN_UPDATE_END);
+static_assert(lengthof(_admin_update_type_frequencies) == ADMIN_UPDATE_UPSTREAM_END);
+
+/**
+ * Get the frequencies which may be registered for a certain update type.
+ * @param type The update type.
+ * @return The frequencies, or 0 if the update type is not supported.
+ */
+static AdminUpdateFrequency GetAdminUpdateTypeFrequencies(uint type)
+{
+	if (type < ADMIN_UPDATE_UPSTREAM_END) return _admin_update_type_frequencies[type];
+
+	switch (type) {
+		case ADMIN_UPDATE_PERFORMANCE: return ADMIN_FREQUENCY_AUTOMATIC;
+		default:                       return (AdminUpdateFrequency)0;
+	}
+}
 
 /**
  * Create a new socket for the server side of the admin network.
@@ -156,9 +180,12 @@ NetworkRecvStatus ServerNetworkAdminSocketHandler::SendProtocol()
 	p->Send_uint8(NETWORK_GAME_ADMIN_VERSION);
 
 	for (int i = 0; i < ADMIN_UPDATE_END; i++) {
+		const AdminUpdateFrequency freq = GetAdminUpdateTypeFrequencies(i);
+		if (freq == 0) continue;
+
 		p->Send_bool  (true);
 		p->Send_uint16(i);
-		p->Send_uint16(_admin_update_type_frequencies[i]);
+		p->Send_uint16(freq);
 	}
 
 	p->Send_bool(false);
@@ -574,6 +601,48 @@ NetworkRecvStatus ServerNetworkAdminSocketHandler::SendPong(uint32_t d1)
 	return NETWORK_RECV_STATUS_OKAY;
 }
 
+/** One sample of the server's performance, see #ADMIN_PACKET_SERVER_PERFORMANCE. */
+struct AdminPerformanceSample {
+	struct PoolInfo {
+		uint32_t items;
+		uint64_t bytes;
+	};
+
+	uint64_t state_ticks;
+	uint16_t ticks;
+	uint32_t overruns;
+	std::array<PerformanceElementTotals, PFE_MAX> elements;
+	std::array<PoolInfo, ADMIN_PERF_POOL_END> pools;
+};
+
+/**
+ * Send a sample of the server's performance.
+ * @param sample The sample to send.
+ */
+NetworkRecvStatus ServerNetworkAdminSocketHandler::SendPerformance(const AdminPerformanceSample &sample)
+{
+	auto p = std::make_unique<Packet>(this, ADMIN_PACKET_SERVER_PERFORMANCE);
+
+	p->Send_uint64(sample.state_ticks);
+	p->Send_uint16(sample.ticks);
+	p->Send_uint32(sample.overruns);
+	p->Send_uint8(PFE_MAX);
+	for (const PerformanceElementTotals &element : sample.elements) {
+		p->Send_uint32(static_cast<uint32_t>(std::min<uint64_t>(element.duration, UINT32_MAX)));
+		p->Send_uint32(static_cast<uint32_t>(std::min<uint64_t>(element.count, UINT32_MAX)));
+	}
+	p->Send_uint8(ADMIN_PERF_POOL_END);
+	for (uint8_t i = 0; i < ADMIN_PERF_POOL_END; i++) {
+		p->Send_uint8(i);
+		p->Send_uint32(sample.pools[i].items);
+		p->Send_uint64(sample.pools[i].bytes);
+	}
+
+	this->SendPacket(std::move(p));
+
+	return NETWORK_RECV_STATUS_OKAY;
+}
+
 /** Send the names of the commands. */
 NetworkRecvStatus ServerNetworkAdminSocketHandler::SendCmdNames()
 {
@@ -677,7 +746,7 @@ NetworkRecvStatus ServerNetworkAdminSocketHandler::Receive_ADMIN_UPDATE_FREQUENC
 	AdminUpdateType type = (AdminUpdateType)p.Recv_uint16();
 	AdminUpdateFrequency freq = (AdminUpdateFrequency)p.Recv_uint16();
 
-	if (type >= ADMIN_UPDATE_END || (_admin_update_type_frequencies[type] & freq) != freq) {
+	if (type >= ADMIN_UPDATE_END || (GetAdminUpdateTypeFrequencies(type) & freq) != freq) {
 		/* The server does not know of this UpdateType. */
 		DEBUG(net, 1, "[admin] Not supported update frequency %d (%d) from '%s' (%s)", type, freq, this->admin_name.c_str(), this->admin_version.c_str());
 		return this->SendError(NETWORK_ERROR_ILLEGAL_PACKET);
@@ -1017,3 +1086,68 @@ void NetworkAdminUpdate(AdminUpdateFrequency freq)
 		}
 	}
 }
+
+/**
+ * Get the pool statistics of a pool type for a performance sample.
+ * @tparam T The pool item type.
+ * @return Number of items and approximate memory usage.
+ */
+template <typename T>
+static AdminPerformanceSample::PoolInfo GetAdminPerformancePoolInfo()
+{
+	return { static_cast<uint32_t>(T::GetNumItems()), (T::GetNumItems() * sizeof(T)) + (T::GetPoolSize() * sizeof(T *)) };
+}
+
+/**
+ * Per-tick handling of the performance samples sent to the admin network.
+ * Once per network.admin_performance_interval ticks, the performance totals are sampled and
+ * the differences since the previous sample sent to all admins which registered for #ADMIN_UPDATE_PERFORMANCE.
+ * Sampling continues even without any registered admins so that the first sample received covers the expected period.
+ */
+void NetworkAdminPerformanceTick()
+{
+	static uint16_t ticks_since_sample = 0;
+	static std::array<PerformanceElementTotals, PFE_MAX> prev_totals{};
+	static uint64_t prev_overruns = 0;
+
+	if (++ticks_since_sample < std::max<uint16_t>(1, _settings_client.network.admin_performance_interval)) return;
+
+	AdminPerformanceSample sample;
+	sample.state_ticks = _state_ticks.base();
+	sample.ticks = ticks_since_sample;
+	ticks_since_sample = 0;
+
+	const uint64_t overruns = GetGameLoopOverrunCount();
+	sample.overruns = static_cast<uint32_t>(std::min<uint64_t>(overruns - prev_overruns, UINT32_MAX));
+	prev_overruns = overruns;
+
+	for (PerformanceElement e = PFE_FIRST; e < PFE_MAX; e++) {
+		const PerformanceElementTotals totals = GetPerformanceElementTotals(e);
+		sample.elements[e] = { totals.duration - prev_totals[e].duration, totals.count - prev_totals[e].count };
+		prev_totals[e] = totals;
+	}
+
+	bool any_active = false;
+	for (ServerNetworkAdminSocketHandler *as : ServerNetworkAdminSocketHandler::IterateActive()) {
+		if (as->update_frequency[ADMIN_UPDATE_PERFORMANCE] & ADMIN_FREQUENCY_AUTOMATIC) {
+			any_active = true;
+			break;
+		}
+	}
+	if (!any_active) return;
+
+	sample.pools[ADMIN_PERF_POOL_VEHICLE] = GetAdminPerformancePoolInfo<Vehicle>();
+	sample.pools[ADMIN_PERF_POOL_CARGO_PACKET] = GetAdminPerformancePoolInfo<CargoPacket>();
+	sample.pools[ADMIN_PERF_POOL_ORDER] = GetAdminPerformancePoolInfo<Order>();
+	sample.pools[ADMIN_PERF_POOL_ORDER_LIST] = GetAdminPerformancePoolInfo<OrderList>();
+	sample.pools[ADMIN_PERF_POOL_STATION] = GetAdminPerformancePoolInfo<BaseStation>();
+	sample.pools[ADMIN_PERF_POOL_TOWN] = GetAdminPerformancePoolInfo<Town>();
+	sample.pools[ADMIN_PERF_POOL_INDUSTRY] = GetAdminPerformancePoolInfo<Industry>();
+	sample.pools[ADMIN_PERF_POOL_LINK_GRAPH] = GetAdminPerformancePoolInfo<LinkGraph>();
+
+	for (ServerNetworkAdminSocketHandler *as : ServerNetworkAdminSocketHandler::IterateActive()) {
+		if (as->update_frequency[ADMIN_UPDATE_PERFORMANCE] & ADMIN_FREQUENCY_AUTOMATIC) {
+			as->SendPerformance(sample);
+		}
+	}
+}
@@ -69,6 +69,7 @@ public:
 	NetworkRecvStatus SendCmdNames();
 	NetworkRecvStatus SendCmdLogging(ClientID client_id, const CommandPacket &cp);
 	NetworkRecvStatus SendRconEnd(const std::string_view command);
+	NetworkRecvStatus SendPerformance(const struct AdminPerformanceSample &sample);
 
 	static void Send();
 	static void AcceptConnection(SOCKET s, const NetworkAddress &address);
@@ -113,5 +114,6 @@ void NetworkServerSendAdminRcon(AdminIndex admin_index, TextColour colour_code,
 void NetworkAdminConsole(const std::string_view origin, const std::string_view string);
 void NetworkAdminGameScript(const std::string_view json);
 void NetworkAdminCmdLogging(const NetworkClientSocket *owner, const CommandPacket &cp);
+void NetworkAdminPerformanceTick();
 
 #endif /* NETWORK_ADMIN_H */
@@ -330,10 +330,19 @@ void ClientNetworkGameSocketHandler::ClientError(NetworkRecvStatus res)
 				DesyncExtraInfo info;
 				if (_sync_seed_1 != _random.state[0]) info.flags |= DesyncExtraInfo::DEIF_RAND;
 				if (_sync_state_checksum != _state_checksum.state) info.flags |= DesyncExtraInfo::DEIF_STATE;
+				for (uint i = 0; i < SCS_END; i++) {
+					if (_sync_state_subsystem_checksums[i] != _state_subsystem_checksums[i]) SetBit(info.state_subsystem_mismatches, i);
+				}
 
 				ShowNetworkError(STR_NETWORK_ERROR_DESYNC);
 				DEBUG(desync, 1, "sync_err: %s {%x, " OTTD_PRINTFHEX64 "} != {%x, " OTTD_PRINTFHEX64 "}",
 						debug_date_dumper().HexDate(), _sync_seed_1, _sync_state_checksum, _random.state[0], _state_checksum.state);
+				for (uint i = 0; i < SCS_END; i++) {
+					if (HasBit(info.state_subsystem_mismatches, i)) {
+						DEBUG(desync, 1, "sync_err: state subsystem: %s: " OTTD_PRINTFHEX64 " != " OTTD_PRINTFHEX64,
+								GetStateChecksumSubsystemName((StateChecksumSubsystem)i), _sync_state_subsystem_checksums[i], _state_subsystem_checksums[i]);
+					}
+				}
 				DEBUG(net, 0, "Sync error detected!");
 
 				std::string desync_log;
@@ -1148,10 +1157,13 @@ NetworkRecvStatus ClientNetworkGameSocketHandler::Receive_SERVER_FRAME(Packet &p
 #ifdef ENABLE_NETWORK_SYNC_EVERY_FRAME
 	/* Test if the server supports this option
 	 *  and if we are at the frame the server is */
-	if (p.CanReadFromPacket(4 + 8)) {
+	if (p.CanReadFromPacket(4 + 8 + (8 * SCS_END))) {
 		_sync_frame = _frame_counter_server;
 		_sync_seed_1 = p.Recv_uint32();
 		_sync_state_checksum = p.Recv_uint64();
+		for (uint64_t &checksum : _sync_state_subsystem_checksums) {
+			checksum = p.Recv_uint64();
+		}
 	}
 #endif
 	/* Receive the token. */
@@ -1178,6 +1190,9 @@ NetworkRecvStatus ClientNetworkGameSocketHandler::Receive_SERVER_SYNC(Packet &p)
 	_sync_frame = p.Recv_uint32();
 	_sync_seed_1 = p.Recv_uint32();
 	_sync_state_checksum = p.Recv_uint64();
+	for (uint64_t &checksum : _sync_state_subsystem_checksums) {
+		checksum = p.Recv_uint64();
+	}
 
 	return NETWORK_RECV_STATUS_OKAY;
 }
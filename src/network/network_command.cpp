@@ -181,6 +181,24 @@ void NetworkFreeLocalCommandQueue()
 	_local_execution_queue.clear();
 }
 
+/**
+ * Serialise a command once, for sending it to all clients.
+ * @param cp The command.
+ * @return The serialised command.
+ */
+static std::shared_ptr<const EncodedCommandPacket> EncodeCommandPacket(const CommandPacket &cp)
+{
+	Packet p(nullptr, PACKET_SERVER_COMMAND, TCP_MTU);
+	const size_t header_size = p.Size();
+	const size_t callback_offset = NetworkGameSocketHandler::SendCommand(p, cp);
+
+	auto encoded = std::make_shared<EncodedCommandPacket>();
+	encoded->data.assign(p.GetBufferData() + header_size, p.GetBufferData() + p.Size());
+	encoded->callback_offset = callback_offset - header_size;
+	encoded->callback_index = encoded->data[encoded->callback_offset];
+	return encoded;
+}
+
 /**
  * "Send" a particular CommandPacket to all clients.
  * @param cp    The command that has to be distributed.
@@ -193,11 +211,24 @@ static void DistributeCommandPacket(CommandPacket &cp, const NetworkClientSocket
 
 	for (NetworkClientSocket *cs : NetworkClientSocket::Iterate()) {
 		if (cs->status >= NetworkClientSocket::STATUS_MAP) {
+			/* The command is serialised once, the clients only need the serialised form */
+			if (cp.encoded == nullptr) cp.encoded = EncodeCommandPacket(cp);
+
+			CommandPacket &c = cs->outgoing_queue.emplace_back();
+			c.tile = cp.tile;
+			c.p1 = cp.p1;
+			c.p2 = cp.p2;
+			c.p3 = cp.p3;
+			c.cmd = cp.cmd;
+			c.frame = cp.frame;
+			c.client_id = cp.client_id;
+			c.company = cp.company;
+			c.encoded = cp.encoded;
+
 			/* Callbacks are only send back to the client who sent them in the
 			 *  first place. This filters that out. */
-			cp.callback = (cs != owner) ? nullptr : callback;
-			cp.my_cmd = (cs == owner);
-			cs->outgoing_queue.push_back(cp);
+			c.callback = (cs != owner) ? nullptr : callback;
+			c.my_cmd = (cs == owner);
 		}
 	}
 
@@ -296,7 +327,7 @@ const char *NetworkGameSocketHandler::ReceiveCommand(Packet &p, CommandPacket &c
  * @param p the packet to send it in.
  * @param cp the packet to actually send.
  */
-void NetworkGameSocketHandler::SendCommand(Packet &p, const CommandPacket &cp)
+size_t NetworkGameSocketHandler::SendCommand(Packet &p, const CommandPacket &cp)
 {
 	p.Send_uint8 (cp.company);
 	p.Send_uint32(cp.cmd);
@@ -315,6 +346,7 @@ void NetworkGameSocketHandler::SendCommand(Packet &p, const CommandPacket &cp)
 		DEBUG(net, 0, "Unknown callback for command; no callback sent (command: %d)", cp.cmd);
 		callback = 0; // _callback_table[0] == nullptr
 	}
+	const size_t callback_offset = p.Size();
 	p.Send_uint8 (callback);
 
 	size_t aux_data_size_pos = p.Size();
@@ -324,4 +356,5 @@ void NetworkGameSocketHandler::SendCommand(Packet &p, const CommandPacket &cp)
 		cp.aux_data->Serialise(serialiser);
 		p.WriteAtOffset_uint16(aux_data_size_pos, (uint16_t)(p.Size() - aux_data_size_pos - 2));
 	}
+	return callback_offset;
 }
@@ -10,6 +10,7 @@
 #ifndef NETWORK_INTERNAL_H
 #define NETWORK_INTERNAL_H
 
+#include "network.h"
 #include "network_func.h"
 #include "network_sync.h"
 #include "core/tcp_coordinator.h"
@@ -17,8 +18,10 @@
 
 #include "../command_type.h"
 #include "../date_type.h"
+#include "../core/checksum_func.hpp"
 
 #include <array>
+#include <memory>
 #include <vector>
 
 static const uint32_t FIND_SERVER_EXTENDED_TOKEN = 0x2A49582A;
@@ -62,6 +65,7 @@ extern NetworkAddressList _broadcast_list;
 
 extern uint32_t _sync_seed_1;
 extern uint64_t _sync_state_checksum;
+extern uint64_t _sync_state_subsystem_checksums[SCS_END];
 extern uint32_t _sync_frame;
 extern EconTime::Date _last_sync_date;
 extern EconTime::DateFract _last_sync_date_fract;
@@ -105,6 +109,15 @@ struct NetworkSharedSecrets {
 };
 
 /* From network_command.cpp */
+/**
+ * Serialised form of a command which is distributed to all clients, so that it is only serialised once.
+ */
+struct EncodedCommandPacket {
+	std::vector<uint8_t> data; ///< The command as written by NetworkGameSocketHandler::SendCommand.
+	size_t callback_offset;    ///< Offset in data of the callback index, which is only set for the client which sent the command.
+	uint8_t callback_index;    ///< Callback index of the client which sent the command.
+};
+
 /**
  * Everything we need to know about a command to be able to execute it.
  */
@@ -115,6 +128,7 @@ struct CommandPacket : CommandContainer {
 	ClientID client_id;  ///< originating client ID (or INVALID_CLIENT_ID if not specified)
 	CompanyID company;   ///< company that is executing the command
 	bool my_cmd;         ///< did the command originate from "me"
+	std::shared_ptr<const EncodedCommandPacket> encoded; ///< Serialised command shared by all clients, if the command is being distributed by the server.
 };
 
 void NetworkDistributeCommands();
@@ -57,6 +57,7 @@ INSTANTIATE_POOL_METHODS(NetworkClientSocket)
 
 /** Instantiate the listen sockets. */
 template SocketList TCPListenHandler<ServerNetworkGameSocketHandler, PACKET_SERVER_FULL, PACKET_SERVER_BANNED>::sockets;
+template NetworkTCPSocketPoller TCPListenHandler<ServerNetworkGameSocketHandler, PACKET_SERVER_FULL, PACKET_SERVER_BANNED>::socket_poller;
 
 static NetworkAuthenticationDefaultPasswordProvider _password_provider(_settings_client.network.server_password); ///< Provides the password validation for the game's password.
 static NetworkAuthenticationDefaultAuthorizedKeyHandler _authorized_key_handler(_settings_client.network.server_authorized_keys); ///< Provides the authorized key handling for the game authentication.
@@ -718,6 +719,9 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendFrame()
 #ifdef ENABLE_NETWORK_SYNC_EVERY_FRAME
 	p->Send_uint32(_sync_seed_1);
 	p->Send_uint64(_sync_state_checksum);
+	for (uint64_t checksum : _sync_state_subsystem_checksums) {
+		p->Send_uint64(checksum);
+	}
 #endif
 
 	/* If token equals 0, we need to make a new token and send that. */
@@ -738,6 +742,9 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendSync()
 	p->Send_uint32(_sync_seed_1);
 
 	p->Send_uint64(_sync_state_checksum);
+	for (uint64_t checksum : _sync_state_subsystem_checksums) {
+		p->Send_uint64(checksum);
+	}
 	this->SendPacket(std::move(p));
 	return NETWORK_RECV_STATUS_OKAY;
 }
@@ -750,7 +757,15 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendCommand(const CommandPacke
 {
 	auto p = std::make_unique<Packet>(this, PACKET_SERVER_COMMAND, TCP_MTU);
 
-	this->NetworkGameSocketHandler::SendCommand(*p, cp);
+	if (cp.encoded != nullptr) {
+		/* The command has already been serialised, only the callback differs per client */
+		const EncodedCommandPacket &encoded = *cp.encoded;
+		p->Send_binary(encoded.data.data(), encoded.callback_offset);
+		p->Send_uint8(cp.callback != nullptr ? encoded.callback_index : 0);
+		p->Send_binary(encoded.data.data() + encoded.callback_offset + 1, encoded.data.size() - encoded.callback_offset - 1);
+	} else {
+		this->NetworkGameSocketHandler::SendCommand(*p, cp);
+	}
 	p->Send_uint32(cp.frame);
 	p->Send_bool  (cp.my_cmd);
 
@@ -2175,6 +2190,8 @@ void NetworkServer_Tick(bool send_frame)
 #endif
 		}
 	}
+
+	NetworkAdminPerformanceTick();
 }
 
 /** Helper function to restart the map. */
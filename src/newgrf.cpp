@@ -58,6 +58,7 @@
 #include "road.h"
 #include "newgrf_roadstop.h"
 #include "debug_settings.h"
+#include "worker_thread.h"
 
 #include "table/strings.h"
 #include "table/build_industry.h"
@@ -11349,6 +11350,110 @@ static void DecodeSpecialSprite(uint8_t *buf, uint num, GrfLoadingStage stage)
 	}
 }
 
+/** Sprite section of a NewGRF file, read ahead on a worker thread. */
+struct GRFSpriteOffsetsPrefetch {
+	std::string filename;          ///< Filename of the NewGRF.
+	Subdirectory subdir;           ///< Subdirectory to find the NewGRF in.
+	bool palette_remap;            ///< Whether the NewGRF needs palette remapping.
+
+	std::mutex lock;
+	std::condition_variable done_cv;
+	bool done = false;             ///< Whether the worker has finished, protected by lock.
+	bool valid = false;            ///< Whether offsets has been read successfully, only valid once done.
+	GrfSpriteOffsets offsets;      ///< The sprite section, only valid once done.
+};
+
+/**
+ * Sprite sections of the NewGRFs being loaded by LoadNewGRF().
+ * The sprite section is needed in both the init and activation stages, so it is read once,
+ * in the background while the earlier loading stages are processed, and then reused.
+ */
+static btree::btree_map<const GRFConfig *, std::unique_ptr<GRFSpriteOffsetsPrefetch>> _grf_sprite_offsets_prefetch;
+
+/**
+ * Start reading the sprite section of a NewGRF on a worker thread.
+ * @param config The NewGRF.
+ * @param subdir The sub directory to find the NewGRF in.
+ */
+static void PrefetchGRFSpriteOffsets(const GRFConfig *config, Subdirectory subdir)
+{
+	std::unique_ptr<GRFSpriteOffsetsPrefetch> &prefetch = _grf_sprite_offsets_prefetch[config];
+	if (prefetch != nullptr) return;
+
+	prefetch = std::make_unique<GRFSpriteOffsetsPrefetch>();
+	prefetch->filename = config->filename;
+	prefetch->subdir = subdir;
+	prefetch->palette_remap = config->palette & GRFP_USE_MASK;
+
+	_general_worker_pool.EnqueueJob([](void *data1, void *, void *) {
+		GRFSpriteOffsetsPrefetch *prefetch = static_cast<GRFSpriteOffsetsPrefetch *>(data1);
+
+		/* SpriteFile does not return on failure to open the file, leave that to be reported by the main thread */
+		bool valid = false;
+		FILE *f = FioFOpenFile(prefetch->filename, "rb", prefetch->subdir);
+		if (f != nullptr) {
+			fclose(f);
+
+			/* This uses a separate file handle, the file may be concurrently read by the main thread */
+			SpriteFile file(prefetch->filename, prefetch->subdir, prefetch->palette_remap);
+			valid = file.GetContainerVersion() != 0;
+			if (valid) ReadGRFSpriteOffsets(file, prefetch->offsets);
+		}
+
+		std::lock_guard<std::mutex> lk(prefetch->lock);
+		prefetch->valid = valid;
+		prefetch->done = true;
+		prefetch->done_cv.notify_all();
+	}, prefetch.get());
+}
+
+/**
+ * Wait for a sprite section read on a worker thread to be finished.
+ * @param prefetch The sprite section being read.
+ */
+static void WaitForGRFSpriteOffsetsPrefetch(GRFSpriteOffsetsPrefetch &prefetch)
+{
+	std::unique_lock<std::mutex> lk(prefetch.lock);
+	prefetch.done_cv.wait(lk, [&]() { return prefetch.done; });
+}
+
+/** Wait for all sprite sections being read on worker threads, and free them. */
+static void ClearGRFSpriteOffsetsPrefetch()
+{
+	for (auto &it : _grf_sprite_offsets_prefetch) {
+		WaitForGRFSpriteOffsetsPrefetch(*it.second);
+	}
+	_grf_sprite_offsets_prefetch.clear();
+}
+
+/**
+ * Set up the sprite section of the NewGRF currently being processed.
+ * This uses the sprite section read ahead by PrefetchGRFSpriteOffsets() if there is one, otherwise the sprite section is read now.
+ * @param config The NewGRF.
+ * @param stage The loading stage, the activation stage is the last one which uses the sprite section.
+ * @param file The NewGRF file, positioned just after the container header.
+ */
+static void LoadGRFSpriteOffsets(const GRFConfig *config, GrfLoadingStage stage, SpriteFile &file)
+{
+	auto it = _grf_sprite_offsets_prefetch.find(config);
+	if (it != _grf_sprite_offsets_prefetch.end() && it->second->filename == file.GetFilename()) {
+		GRFSpriteOffsetsPrefetch &prefetch = *it->second;
+		WaitForGRFSpriteOffsetsPrefetch(prefetch);
+		if (prefetch.valid) {
+			if (stage == GLS_ACTIVATION) {
+				/* Last use of the sprite section, no need to keep it */
+				prefetch.valid = false;
+				SetGRFSpriteOffsets(file, std::move(prefetch.offsets));
+			} else {
+				SetGRFSpriteOffsets(file, prefetch.offsets);
+			}
+			return;
+		}
+	}
+
+	ReadGRFSpriteOffsets(file);
+}
+
 /**
  * Load a particular NewGRF from a SpriteFile.
  * @param config The configuration of the to be loaded NewGRF.
@@ -11371,7 +11476,7 @@ static void LoadNewGRFFileFromFile(GRFConfig *config, GrfLoadingStage stage, Spr
 	if (stage == GLS_INIT || stage == GLS_ACTIVATION) {
 		/* We need the sprite offsets in the init stage for NewGRF sounds
 		 * and in the activation stage for real sprites. */
-		ReadGRFSpriteOffsets(file);
+		LoadGRFSpriteOffsets(config, stage, file);
 	} else {
 		/* Skip sprite section offset if present. */
 		if (grf_container_version >= 2) file.ReadDword();
@@ -11879,6 +11984,8 @@ void LoadNewGRF(uint load_index, uint num_baseset)
 
 			num_grfs++;
 
+			if (stage == GLS_LABELSCAN) PrefetchGRFSpriteOffsets(c, subdir);
+
 			LoadNewGRFFile(c, stage, subdir, false);
 			if (stage == GLS_RESERVE) {
 				SetBit(c->flags, GCF_RESERVED);
@@ -11898,6 +12005,7 @@ void LoadNewGRF(uint load_index, uint num_baseset)
 
 	/* Pseudo sprite processing is finished; free temporary stuff */
 	_cur.ClearDataForNextFile();
+	ClearGRFSpriteOffsetsPrefetch();
 	_callback_result_cache.clear();
 
 	/* Call any functions that should be run after GRFs have been loaded. */
@@ -25,6 +25,7 @@
 #include "newgrf_class_func.h"
 #include "newgrf_extension.h"
 #include "newgrf_dump.h"
+#include "worker_thread.h"
 #include "core/checksum_func.hpp"
 
 #include "safeguards.h"
@@ -1109,8 +1110,10 @@ void UpdateStationTileCacheFlags(bool force_update)
 	if (checksum.state != _station_tile_cache_hash || force_update) {
 		_station_tile_cache_hash = checksum.state;
 
-		for (TileIndex t = 0; t < MapSize(); t++) {
-			if (HasStationTileRail(t)) SetRailStationTileFlags(t, GetStationSpec(t));
-		}
+		_general_worker_pool.RunParallelChunks(MapSize(), WORKER_MAP_CHUNK_SIZE, [](size_t begin, size_t end) {
+			for (TileIndex t = (TileIndex)begin; t < end; t++) {
+				if (HasStationTileRail(t)) SetRailStationTileFlags(t, GetStationSpec(t));
+			}
+		});
 	}
 }
@@ -133,6 +133,21 @@ bool _request_newgrf_scan = false;
 NewGRFScanCallback *_request_newgrf_scan_callback = nullptr;
 
 SimpleChecksum64 _state_checksum;
+uint64_t _state_subsystem_checksums[SCS_END];
+
+const char *GetStateChecksumSubsystemName(StateChecksumSubsystem subsystem)
+{
+	static const char * const names[] = {
+		"general",
+		"vehicle",
+		"station",
+		"cargo",
+		"map",
+		"company",
+	};
+	static_assert(lengthof(names) == SCS_END);
+	return subsystem < SCS_END ? names[subsystem] : "???";
+}
 
 std::mutex _music_driver_mutex;
 static std::string _music_driver_params;
@@ -705,6 +720,7 @@ struct AfterNewGRFScan : NewGRFScanCallback {
 void PostMainLoop()
 {
 	WaitTillSaved();
+	WaitTillForkedSaved();
 
 	/* only save config if we have to */
 	if (_save_config) {
@@ -1695,37 +1711,37 @@ void StateGameLoop()
 
 		if (_networking) {
 			RecordSyncEvent(NSRE_PRE_DATES);
-			UpdateStateChecksum(_tick_counter);
-			UpdateStateChecksum(_scaled_tick_counter);
-			UpdateStateChecksum(_state_ticks.base());
-			UpdateStateChecksum(CalTime::CurDate().base());
-			UpdateStateChecksum(CalTime::CurDateFract());
-			UpdateStateChecksum(CalTime::CurSubDateFract());
-			UpdateStateChecksum(EconTime::CurDate().base());
-			UpdateStateChecksum(EconTime::CurDateFract());
-			UpdateStateChecksum(TickSkipCounter());
+			UpdateStateChecksum(SCS_GENERAL, _tick_counter);
+			UpdateStateChecksum(SCS_GENERAL, _scaled_tick_counter);
+			UpdateStateChecksum(SCS_GENERAL, _state_ticks.base());
+			UpdateStateChecksum(SCS_GENERAL, CalTime::CurDate().base());
+			UpdateStateChecksum(SCS_GENERAL, CalTime::CurDateFract());
+			UpdateStateChecksum(SCS_GENERAL, CalTime::CurSubDateFract());
+			UpdateStateChecksum(SCS_GENERAL, EconTime::CurDate().base());
+			UpdateStateChecksum(SCS_GENERAL, EconTime::CurDateFract());
+			UpdateStateChecksum(SCS_GENERAL, TickSkipCounter());
 
 			RecordSyncEvent(NSRE_PRE_COMPANY_STATE);
 			for (Company *c : Company::Iterate()) {
 				DEBUG_UPDATESTATECHECKSUM("Company: %u, Money: " OTTD_PRINTF64, c->index, (int64_t)c->money);
-				UpdateStateChecksum(c->money);
+				UpdateStateChecksum(SCS_COMPANY, c->money);
 
 				for (uint i = 0; i < ROADTYPE_END; i++) {
 					DEBUG_UPDATESTATECHECKSUM("Company: %u, road[%u]: %u", c->index, i, c->infrastructure.road[i]);
-					UpdateStateChecksum(c->infrastructure.road[i]);
+					UpdateStateChecksum(SCS_COMPANY, c->infrastructure.road[i]);
 				}
 
 				for (uint i = 0; i < RAILTYPE_END; i++) {
 					DEBUG_UPDATESTATECHECKSUM("Company: %u, rail[%u]: %u", c->index, i, c->infrastructure.rail[i]);
-					UpdateStateChecksum(c->infrastructure.rail[i]);
+					UpdateStateChecksum(SCS_COMPANY, c->infrastructure.rail[i]);
 				}
 
 				DEBUG_UPDATESTATECHECKSUM("Company: %u, signal: %u, water: %u, station: %u, airport: %u",
 						c->index, c->infrastructure.signal, c->infrastructure.water, c->infrastructure.station, c->infrastructure.airport);
-				UpdateStateChecksum(c->infrastructure.signal);
-				UpdateStateChecksum(c->infrastructure.water);
-				UpdateStateChecksum(c->infrastructure.station);
-				UpdateStateChecksum(c->infrastructure.airport);
+				UpdateStateChecksum(SCS_COMPANY, c->infrastructure.signal);
+				UpdateStateChecksum(SCS_COMPANY, c->infrastructure.water);
+				UpdateStateChecksum(SCS_COMPANY, c->infrastructure.station);
+				UpdateStateChecksum(SCS_COMPANY, c->infrastructure.airport);
 			}
 		}
 		cur_company.Restore();
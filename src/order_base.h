@@ -968,6 +968,10 @@ private:
 
 	std::vector<DispatchSchedule> dispatch_schedules; ///< Scheduled dispatch schedules
 
+	mutable std::vector<CargoTypes> cargo_load_unload_groups; ///< NOSAVE: Cache of the sets of cargoes with identical load/unload flags in all orders, empty if not yet calculated.
+
+	void FillCargoLoadUnloadGroups() const;
+
 public:
 	/** Default constructor producing an invalid order list. */
 	OrderList(VehicleOrderID num_orders = INVALID_VEH_ORDER_ID)
@@ -1025,6 +1029,12 @@ public:
 	inline VehicleOrderID GetNumManualOrders() const { return this->num_manual_orders; }
 
 	CargoMaskedStationIDStack GetNextStoppingStation(const Vehicle *v, CargoTypes cargo_mask, const Order *first = nullptr, uint hops = 0) const;
+	CargoTypes GetCargoLoadUnloadGroup(CargoTypes cargo_mask) const;
+
+	/**
+	 * Must be called if the load or unload flags of any order are changed in place.
+	 */
+	inline void InvalidateCargoLoadUnloadGroups() { this->cargo_load_unload_groups.clear(); }
 	const Order *GetNextDecisionNode(const Order *next, uint hops, CargoTypes &cargo_mask) const;
 
 	void InsertOrderAt(Order *new_order, int index);
@@ -463,6 +463,7 @@ void CargoStationIDStackSet::FillNextStoppingStation(const Vehicle *v, const Ord
 
 void OrderList::ReindexOrderList()
 {
+	this->InvalidateCargoLoadUnloadGroups();
 	this->order_index.clear();
 	for (Order *o = this->first; o != nullptr; o = o->next) {
 		this->order_index.push_back(o);
@@ -494,6 +495,7 @@ void OrderList::Initialize(Order *chain, Vehicle *v)
 	this->timetable_duration = 0;
 	this->total_duration = 0;
 	this->order_index.clear();
+	this->InvalidateCargoLoadUnloadGroups();
 
 	VehicleType type = v->type;
 	Owner owner = v->owner;
@@ -551,6 +553,7 @@ void OrderList::FreeChain(bool keep_orderlist)
 		this->num_manual_orders = 0;
 		this->timetable_duration = 0;
 		this->order_index.clear();
+		this->InvalidateCargoLoadUnloadGroups();
 	} else {
 		delete this;
 	}
@@ -730,6 +733,52 @@ CargoMaskedStationIDStack OrderList::GetNextStoppingStation(const Vehicle *v, Ca
 	return CargoMaskedStationIDStack(cargo_mask, next->GetDestination());
 }
 
+/**
+ * Partition all cargoes into the sets of cargoes which have identical load and unload flags in all station orders.
+ */
+void OrderList::FillCargoLoadUnloadGroups() const
+{
+	this->cargo_load_unload_groups.clear();
+
+	CargoTypes remaining = ALL_CARGOTYPES;
+	while (remaining != 0) {
+		CargoTypes group = remaining;
+		for (const Order *o = this->first; o != nullptr; o = o->next) {
+			if (o->IsType(OT_GOTO_STATION) || o->IsType(OT_IMPLICIT)) {
+				if (o->GetUnloadType() == OUFB_CARGO_TYPE_UNLOAD) {
+					CargoMaskValueFilter<uint>(group, [&](CargoID cargo) -> uint {
+						return o->GetCargoUnloadType(cargo) & (OUFB_TRANSFER | OUFB_UNLOAD | OUFB_NO_UNLOAD);
+					});
+				}
+				if (o->GetLoadType() == OLFB_CARGO_TYPE_LOAD) {
+					CargoMaskValueFilter<uint>(group, [&](CargoID cargo) -> uint {
+						return o->GetCargoLoadType(cargo) & (OLFB_NO_LOAD);
+					});
+				}
+			}
+		}
+		this->cargo_load_unload_groups.push_back(group);
+		remaining &= ~group;
+	}
+}
+
+/**
+ * Get the set of cargoes in \a cargo_mask which have the same load and unload flags as the first cargo in \a cargo_mask, in all station orders.
+ * The partitioning of cargoes is cached, as it only changes when the orders change.
+ * @param cargo_mask Non-empty mask of cargoes to consider.
+ * @return Subset of \a cargo_mask, including at least the first cargo.
+ */
+CargoTypes OrderList::GetCargoLoadUnloadGroup(CargoTypes cargo_mask) const
+{
+	if (this->cargo_load_unload_groups.empty()) this->FillCargoLoadUnloadGroups();
+
+	const CargoID first_cargo = FindFirstBit(cargo_mask);
+	for (CargoTypes group : this->cargo_load_unload_groups) {
+		if (HasBit(group, first_cargo)) return group & cargo_mask;
+	}
+	NOT_REACHED();
+}
+
 /**
  * Insert a new order into the order chain.
  * @param new_order is the order to insert into the chain.
@@ -897,6 +946,12 @@ void OrderList::DebugCheckSanity() const
 			(uint)this->GetNumOrders(), (uint)this->num_manual_orders,
 			this->num_vehicles, this->timetable_duration, this->total_duration);
 	assert(this->CheckOrderListIndexing());
+
+	if (!this->cargo_load_unload_groups.empty()) {
+		std::vector<CargoTypes> cached = this->cargo_load_unload_groups;
+		this->FillCargoLoadUnloadGroups();
+		assert(cached == this->cargo_load_unload_groups);
+	}
 }
 #endif
 
@@ -2500,6 +2555,8 @@ CommandCost CmdModifyOrder(TileIndex tile, DoCommandFlag flags, uint32_t p1, uin
 			default: NOT_REACHED();
 		}
 
+		v->orders->InvalidateCargoLoadUnloadGroups();
+
 		/* Update the windows and full load flags, also for vehicles that share the same order list */
 		Vehicle *u = v->FirstShared();
 		DeleteOrderWarnings(u);
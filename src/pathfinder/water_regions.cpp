@@ -19,6 +19,7 @@
 #include "tunnelbridge_map.h"
 #include "follow_track.hpp"
 #include "ship.h"
+#include "yapf/yapf_ship_regions.h"
 
 #include <array>
 #include <limits>
@@ -312,7 +313,13 @@ bool WaterRegion::IsInitialized(uint region_id)
 
 void WaterRegion::Invalidate(uint region_id)
 {
-	ClrBit(_is_water_region_valid[region_id / REGION_VALID_BLOCK_BITS], region_id % REGION_VALID_BLOCK_BITS);
+	RegionValidBlockT &block = _is_water_region_valid[region_id / REGION_VALID_BLOCK_BITS];
+	if (!HasBit(block, region_id % REGION_VALID_BLOCK_BITS)) return;
+
+	ClrBit(block, region_id % REGION_VALID_BLOCK_BITS);
+
+	/* Cached region paths only ever depend on valid regions, so this is only necessary when the region was previously valid. */
+	InvalidateWaterRegionPathCache(region_id);
 }
 
 bool WaterRegion::MarkedValid(uint region_id)
@@ -525,6 +532,7 @@ void InitializeWaterRegions()
 {
 	_water_regions.reset(new WaterRegion[GetWaterRegionMapSizeX() * GetWaterRegionMapSizeY()]);
 	_is_water_region_valid.reset(new RegionValidBlockT[GetWaterRegionValidSize()]{});
+	ClearWaterRegionPathCache();
 }
 
 uint GetWaterRegionTileDebugColourIndex(TileIndex tile)
@@ -568,6 +576,7 @@ uint GetWaterRegionTileDebugColourIndex(TileIndex tile)
 void DebugInvalidateAllWaterRegions()
 {
 	std::fill(_is_water_region_valid.get(), _is_water_region_valid.get() + GetWaterRegionValidSize(), 0);
+	ClearWaterRegionPathCache();
 }
 
 void DebugInitAllWaterRegions()
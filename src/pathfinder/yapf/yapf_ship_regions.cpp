@@ -15,11 +15,73 @@
 #include "yapf_ship_regions.h"
 #include "../water_regions.h"
 
+#include <unordered_map>
+
 #include "../../safeguards.h"
 
 constexpr int DIRECT_NEIGHBOR_COST = 100;
 constexpr int NODES_PER_REGION = 4;
 constexpr uint32_t MAX_NUMBER_OF_NODES = 65536;
+constexpr size_t MAX_PATH_CACHE_ENTRIES = 16384;
+
+/**
+ * Key of the water region path cache.
+ * The result of a region path search is entirely determined by the start patch, the ordered list of origin (destination) patches
+ * and the requested path length, together with the state of the water regions which the search looked at.
+ */
+struct WaterRegionPathCacheKey {
+	WaterRegionPatchDesc start;
+	std::vector<WaterRegionPatchDesc> origins;
+	int max_returned_path_length;
+
+	bool operator==(const WaterRegionPathCacheKey &other) const
+	{
+		return this->start == other.start && this->origins == other.origins && this->max_returned_path_length == other.max_returned_path_length;
+	}
+};
+
+struct WaterRegionPathCacheKeyHash {
+	size_t operator()(const WaterRegionPathCacheKey &key) const
+	{
+		size_t hash = CalculateWaterRegionPatchHash(key.start) ^ (key.max_returned_path_length << 24);
+		for (const WaterRegionPatchDesc &origin : key.origins) {
+			hash = (hash * 31) ^ CalculateWaterRegionPatchHash(origin);
+		}
+		return hash;
+	}
+};
+
+struct WaterRegionPathCacheEntry {
+	std::vector<WaterRegionPatchDesc> path;
+	uint32_t id;
+};
+
+/**
+ * Cache of region path search results.
+ * Entries are removed when any water region which was read by the search which produced them is invalidated,
+ * such that a cached result is always identical to the result of a new search. This is required as the cache
+ * is not saved and so is not the same for all clients in a multiplayer game.
+ */
+static std::unordered_map<WaterRegionPathCacheKey, WaterRegionPathCacheEntry, WaterRegionPathCacheKeyHash> _water_region_path_cache;
+static std::unordered_map<uint32_t, const WaterRegionPathCacheKey *> _water_region_path_cache_ids;
+static std::unordered_map<TWaterRegionIndex, std::vector<uint32_t>> _water_region_path_cache_region_index;
+static uint32_t _water_region_path_cache_next_id = 0;
+
+static void AddWaterRegionPathCacheEntry(WaterRegionPathCacheKey key, const std::vector<WaterRegionPatchDesc> &path, std::vector<TWaterRegionIndex> &used_regions)
+{
+	if (_water_region_path_cache.size() >= MAX_PATH_CACHE_ENTRIES) ClearWaterRegionPathCache();
+
+	const uint32_t id = _water_region_path_cache_next_id++;
+	auto res = _water_region_path_cache.insert({ std::move(key), WaterRegionPathCacheEntry{ path, id } });
+	if (!res.second) return;
+	_water_region_path_cache_ids[id] = &(res.first->first);
+
+	std::sort(used_regions.begin(), used_regions.end());
+	used_regions.erase(std::unique(used_regions.begin(), used_regions.end()), used_regions.end());
+	for (TWaterRegionIndex region : used_regions) {
+		_water_region_path_cache_region_index[region].push_back(id);
+	}
+}
 
 /** Yapf Node Key that represents a single patch of interconnected water within a water region. */
 struct CYapfRegionPatchNodeKey {
@@ -114,6 +176,16 @@ public:
 		return std::find(m_origin_keys.begin(), m_origin_keys.end(), CYapfRegionPatchNodeKey{ water_region_patch }) != m_origin_keys.end();
 	}
 
+	std::vector<WaterRegionPatchDesc> GetOrigins() const
+	{
+		std::vector<WaterRegionPatchDesc> origins;
+		origins.reserve(m_origin_keys.size());
+		for (const CYapfRegionPatchNodeKey &origin_key : m_origin_keys) {
+			origins.push_back(origin_key.m_water_region_patch);
+		}
+		return origins;
+	}
+
 	void PfSetStartupNodes()
 	{
 		for (const CYapfRegionPatchNodeKey &origin_key : m_origin_keys) {
@@ -177,16 +249,33 @@ public:
 protected:
 	inline Tpf &Yapf() { return *static_cast<Tpf*>(this); }
 
+	std::vector<TWaterRegionIndex> m_used_regions; ///< Water regions read by the search, these determine the validity of the result.
+
+	void AddUsedRegion(uint32_t x, uint32_t y)
+	{
+		if (x >= (MapSizeX() / WATER_REGION_EDGE_LENGTH) || y >= (MapSizeY() / WATER_REGION_EDGE_LENGTH)) return;
+		m_used_regions.push_back(GetWaterRegionIndex(WaterRegionDesc(x, y)));
+	}
+
 public:
 	inline void PfFollowNode(Node &old_node)
 	{
+		const WaterRegionPatchDesc &patch = old_node.m_key.m_water_region_patch;
+		/* Following a node reads the region itself and each of the adjacent regions, unsigned underflow is caught by the bounds check. */
+		AddUsedRegion(patch.x, patch.y);
+		for (DiagDirection side = DIAGDIR_BEGIN; side < DIAGDIR_END; side++) {
+			const TileIndexDiffC offset = TileIndexDiffCByDiagDir(side);
+			AddUsedRegion(patch.x + (uint32_t)offset.x, patch.y + (uint32_t)offset.y);
+		}
+
 		TVisitWaterRegionPatchCallBack visitFunc = [&](const WaterRegionPatchDesc &water_region_patch)
 		{
+			AddUsedRegion(water_region_patch.x, water_region_patch.y);
 			Node &node = Yapf().CreateNewNode();
 			node.Set(&old_node, water_region_patch);
 			Yapf().AddNewNode(node, TrackFollower{});
 		};
-		VisitWaterRegionPatchNeighbors(old_node.m_key.m_water_region_patch, visitFunc);
+		VisitWaterRegionPatchNeighbors(patch, visitFunc);
 	}
 
 	inline char TransportTypeChar() const { return '^'; }
@@ -220,6 +309,10 @@ public:
 		path.reserve(max_returned_path_length);
 		if (pf.HasOrigin(start_water_region_patch)) return path;
 
+		WaterRegionPathCacheKey cache_key{ start_water_region_patch, pf.GetOrigins(), max_returned_path_length };
+		auto cached = _water_region_path_cache.find(cache_key);
+		if (cached != _water_region_path_cache.end()) return cached->second.path;
+
 		/* Find best path. */
 		if (!pf.FindPath(v)) return {}; // Path not found.
 
@@ -232,6 +325,13 @@ public:
 		}
 
 		assert(!path.empty());
+
+		pf.AddUsedRegion(start_water_region_patch.x, start_water_region_patch.y);
+		for (const WaterRegionPatchDesc &origin : cache_key.origins) {
+			pf.AddUsedRegion(origin.x, origin.y);
+		}
+		AddWaterRegionPathCacheEntry(std::move(cache_key), path, pf.m_used_regions);
+
 		return path;
 	}
 };
@@ -303,6 +403,34 @@ struct CYapfRegionWater : CYapfT<CYapfRegion_TypesT<CYapfRegionWater, CRegionNod
 	explicit CYapfRegionWater(int max_nodes) { m_max_search_nodes = max_nodes; }
 };
 
+/**
+ * Remove all cached region paths which depend on the given water region.
+ * @param region_id The water region which has been invalidated.
+ */
+void InvalidateWaterRegionPathCache(TWaterRegionIndex region_id)
+{
+	auto iter = _water_region_path_cache_region_index.find(region_id);
+	if (iter == _water_region_path_cache_region_index.end()) return;
+
+	for (uint32_t id : iter->second) {
+		auto id_iter = _water_region_path_cache_ids.find(id);
+		if (id_iter == _water_region_path_cache_ids.end()) continue; // Already removed via another region
+		_water_region_path_cache.erase(_water_region_path_cache.find(*(id_iter->second)));
+		_water_region_path_cache_ids.erase(id_iter);
+	}
+	_water_region_path_cache_region_index.erase(iter);
+}
+
+/**
+ * Remove all cached region paths.
+ */
+void ClearWaterRegionPathCache()
+{
+	_water_region_path_cache.clear();
+	_water_region_path_cache_ids.clear();
+	_water_region_path_cache_region_index.clear();
+}
+
 /**
  * Finds a path at the water region level. Note that the starting region is always included if the path was found.
  * @param v The ship to find a path for.
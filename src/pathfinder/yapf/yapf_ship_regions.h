@@ -17,5 +17,7 @@
 struct Ship;
 
 std::vector<WaterRegionPatchDesc> YapfShipFindWaterRegionPath(const Ship *v, TileIndex start_tile, int max_returned_path_length);
+void InvalidateWaterRegionPathCache(TWaterRegionIndex region_id);
+void ClearWaterRegionPathCache();
 
 #endif /* YAPF_SHIP_REGIONS_H */
@@ -3393,6 +3393,7 @@ void MarkSingleSignalDirtyIntl(TileIndex tile, Trackdir td, bool opposite, F get
 	uint x, y;
 	GetSignalXYByTrackdir(tile, td, opposite, x, y);
 	Point pt = RemapCoords(x, y, get_z(x, y));
+	MarkTileDrawCacheDirty(tile);
 	MarkAllViewportsDirty(
 			pt.x - SIGNAL_DIRTY_LEFT,
 			pt.y - SIGNAL_DIRTY_TOP,
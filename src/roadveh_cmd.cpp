@@ -701,20 +701,26 @@ struct RoadVehFindData {
 	RoadTypeCollisionMode collision_mode;
 };
 
+/** Extent ahead of a road vehicle, per direction, within which another road vehicle blocks it. Never zero. */
+static const int8_t _road_veh_close_dist_x[] = { -4, -8, -4, -1, 4, 8, 4, 1 };
+static const int8_t _road_veh_close_dist_y[] = { -4, -1, 4, 8, 4, 1, -4, -8 };
+
 static Vehicle *EnumCheckRoadVehClose(Vehicle *veh, void *data)
 {
-	static const int8_t dist_x[] = { -4, -8, -4, -1, 4, 8, 4, 1 };
-	static const int8_t dist_y[] = { -4, -1, 4, 8, 4, 1, -4, -8 };
+	const int8_t *dist_x = _road_veh_close_dist_x;
+	const int8_t *dist_y = _road_veh_close_dist_y;
 
 	RoadVehFindData *rvf = (RoadVehFindData*)data;
 	RoadVehicle *v = RoadVehicle::From(veh);
 
+	/* Cheapest and most selective test first */
+	if (v->direction != rvf->dir) return nullptr;
+
 	short x_diff = v->x_pos - rvf->x;
 	short y_diff = v->y_pos - rvf->y;
 
 	if (!v->IsInDepot() &&
 			abs(v->z_pos - rvf->veh->z_pos) < 6 &&
-			v->direction == rvf->dir &&
 			rvf->veh->First() != v->First() &&
 			HasBit(_collision_mode_roadtypes[rvf->collision_mode], v->roadtype) &&
 			(dist_x[v->direction] >= 0 || (x_diff > dist_x[v->direction] && x_diff <= 0)) &&
@@ -752,7 +758,15 @@ static RoadVehicle *RoadVehFindCloseTo(RoadVehicle *v, int x, int y, Direction d
 		FindVehicleOnPos(v->tile, VEH_ROAD, &rvf, EnumCheckRoadVehClose);
 		FindVehicleOnPos(GetOtherTunnelBridgeEnd(v->tile), VEH_ROAD, &rvf, EnumCheckRoadVehClose);
 	} else {
-		FindVehicleOnPosXY(x, y, VEH_ROAD, &rvf, EnumCheckRoadVehClose);
+		/* Only vehicles within the area ahead in the direction of travel can match, only scan the tiles covering that area.
+		 * The area is widened by a tile on each side, as vehicles are hashed by their tile, which may differ from the tile of their position. */
+		const int dx = _road_veh_close_dist_x[dir];
+		const int dy = _road_veh_close_dist_y[dir];
+		const int xl = ((dx < 0) ? x + dx + 1 : x) - (int)TILE_SIZE;
+		const int xu = ((dx < 0) ? x : x + dx - 1) + (int)TILE_SIZE;
+		const int yl = ((dy < 0) ? y + dy + 1 : y) - (int)TILE_SIZE;
+		const int yu = ((dy < 0) ? y : y + dy - 1) + (int)TILE_SIZE;
+		FindVehicleOnPosXYRect(std::max(xl, 0), std::max(yl, 0), xu, yu, VEH_ROAD, &rvf, EnumCheckRoadVehClose);
 	}
 
 	/* This code protects a roadvehicle from being blocked for ever
@@ -1289,7 +1303,7 @@ static Trackdir RoadFindPathToDest(RoadVehicle *v, TileIndex tile, DiagDirection
 
 	best_track = YapfRoadVehicleChooseTrack(v, tile, enterdir, trackdirs, path_found, v->GetOrCreatePathCache());
 	DEBUG_UPDATESTATECHECKSUM("RoadFindPathToDest: v: %u, path_found: %d, best_track: %d", v->index, path_found, best_track);
-	UpdateStateChecksum((((uint64_t) v->index) << 32) | (path_found << 16) | best_track);
+	UpdateStateChecksum(SCS_VEHICLE, (((uint64_t) v->index) << 32) | (path_found << 16) | best_track);
 	v->HandlePathfindingResult(path_found);
 
 found_best_track:;
@@ -2229,9 +2243,9 @@ Money RoadVehicle::GetRunningCost() const
 bool RoadVehicle::Tick()
 {
 	DEBUG_UPDATESTATECHECKSUM("RoadVehicle::Tick 1: v: %u, x: %d, y: %d", this->index, this->x_pos, this->y_pos);
-	UpdateStateChecksum((((uint64_t) this->x_pos) << 32) | this->y_pos);
+	UpdateStateChecksum(SCS_VEHICLE, (((uint64_t) this->x_pos) << 32) | this->y_pos);
 	DEBUG_UPDATESTATECHECKSUM("RoadVehicle::Tick 2: v: %u, state: %d, frame: %d", this->index, this->state, this->frame);
-	UpdateStateChecksum((((uint64_t) this->state) << 32) | this->frame);
+	UpdateStateChecksum(SCS_VEHICLE, (((uint64_t) this->state) << 32) | this->frame);
 	if (this->IsFrontEngine()) {
 		if (!(this->IsRoadVehicleStopped() || this->IsWaitingInDepot())) this->running_ticks++;
 		return RoadVehController(this);
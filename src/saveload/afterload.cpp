@@ -75,12 +75,15 @@
 #include "../timer/timer.h"
 #include "../timer/timer_game_tick.h"
 #include "../pathfinder/water_regions.h"
+#include "../worker_thread.h"
+#include "../core/format.hpp"
 
 
 #include "../sl/saveload_internal.h"
 
 #include <signal.h>
 #include <algorithm>
+#include <chrono>
 
 #include "../safeguards.h"
 
@@ -667,6 +670,48 @@ void IterateVehicleAndOrderListOrders(F func)
 	}
 }
 
+/** Records the time taken by each stage of AfterLoadGame(), for the dump_load_debug_log console command. */
+struct AfterLoadStageTimer {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point last = start;
+
+	AfterLoadStageTimer()
+	{
+		_loadgame_afterload_timings = "AfterLoadGame stage timings:\n";
+	}
+
+	void Stage(const char *name)
+	{
+		auto now = std::chrono::steady_clock::now();
+		fmt::format_to(std::back_inserter(_loadgame_afterload_timings), "  {}: {} us\n", name, std::chrono::duration_cast<std::chrono::microseconds>(now - this->last).count());
+		this->last = now;
+	}
+
+	/**
+	 * Run a pass over every map tile which only reads and writes the tile itself, split over the worker threads.
+	 * The serial work since the previous stage and the pass itself are timed separately.
+	 * @param name Name of the pass.
+	 * @param proc Procedure to call for each tile.
+	 */
+	template <typename F>
+	void ParallelTilePass(const char *name, F proc)
+	{
+		this->Stage("Serial conversions");
+		_general_worker_pool.RunParallelChunks(MapSize(), WORKER_MAP_CHUNK_SIZE, [&](size_t begin, size_t end) {
+			for (TileIndex t = (TileIndex)begin; t < end; t++) {
+				proc(t);
+			}
+		});
+		this->Stage(name);
+	}
+
+	void Finish()
+	{
+		this->Stage("Scripts and companies");
+		fmt::format_to(std::back_inserter(_loadgame_afterload_timings), "  Total: {} us\n", std::chrono::duration_cast<std::chrono::microseconds>(this->last - this->start).count());
+	}
+};
+
 /**
  * Perform a (large) amount of savegame conversion *magic* in order to
  * load older savegames and to fill the caches for various purposes.
@@ -674,6 +719,8 @@ void IterateVehicleAndOrderListOrders(F func)
  */
 bool AfterLoadGame()
 {
+	AfterLoadStageTimer stage_timer;
+
 	SetSignalHandlers();
 
 	TileIndex map_size = MapSize();
@@ -709,6 +756,8 @@ bool AfterLoadGame()
 
 	_viewport_sign_kdtree_valid = false;
 
+	stage_timer.Stage("Setup and kd-trees");
+
 	if (IsSavegameVersionBefore(SLV_98)) GamelogGRFAddList(_grfconfig);
 
 	if (IsSavegameVersionBefore(SLV_119)) {
@@ -757,7 +806,7 @@ bool AfterLoadGame()
 		_settings_game.construction.map_height_limit = 15;
 
 		/* In old savegame versions, the heightlevel was coded in bits 0..3 of the type field */
-		for (TileIndex t = 0; t < map_size; t++) {
+		stage_timer.ParallelTilePass("Height field conversion", [](TileIndex t) {
 			_m[t].height = GB(_m[t].type, 0, 4);
 			SB(_m[t].type, 0, 2, GB(_me[t].m6, 0, 2));
 			SB(_me[t].m6, 0, 2, 0);
@@ -767,7 +816,7 @@ bool AfterLoadGame()
 			} else {
 				SB(_m[t].type, 2, 2, 0);
 			}
-		}
+		});
 	} else if (IsSavegameVersionBefore(SLV_194) && SlXvIsFeaturePresent(XSLFI_HEIGHT_8_BIT)) {
 		for (TileIndex t = 0; t < map_size; t++) {
 			SB(_m[t].type, 0, 2, GB(_me[t].m6, 0, 2));
@@ -962,6 +1011,8 @@ bool AfterLoadGame()
 		LinkGraphFixupAfterLoad(SlXvIsFeatureMissing(XSLFI_LINKGRAPH_DAY_SCALE, 4));
 	}
 
+	stage_timer.Stage("Map conversions (early)");
+
 	/* Load the sprites */
 	GfxLoadSprites();
 	LoadStringWidthTable();
@@ -1058,6 +1109,8 @@ bool AfterLoadGame()
 	/* Update template vehicles */
 	AfterLoadTemplateVehicles();
 
+	stage_timer.Stage("Sprites, engines and vehicles phase 1");
+
 	/* make sure there is a town in the game */
 	if (_game_mode == GM_NORMAL && Town::GetNumItems() == 0) {
 		SetSaveLoadError(STR_ERROR_NO_TOWN_IN_SCENARIO);
@@ -1605,11 +1658,11 @@ bool AfterLoadGame()
 
 	if (SlXvIsFeatureMissing(XSLFI_DUAL_RAIL_TYPES)) {
 		/* Introduced dual rail types. */
-		for (TileIndex t = 0; t < map_size; t++) {
+		stage_timer.ParallelTilePass("Dual rail types", [](TileIndex t) {
 			if (IsPlainRailTile(t) || (IsRailTunnelBridgeTile(t) && IsBridge(t))) {
 				SetSecondaryRailType(t, GetRailType(t));
 			}
-		}
+		});
 	}
 
 	if (SlXvIsFeaturePresent(XSLFI_SIG_TUNNEL_BRIDGE, 1, 6)) {
@@ -1635,20 +1688,20 @@ bool AfterLoadGame()
 
 	if (!SlXvIsFeaturePresent(XSLFI_CUSTOM_BRIDGE_HEADS, 2)) {
 		/* change map bits for rail bridge heads */
-		for (TileIndex t = 0; t < map_size; t++) {
+		stage_timer.ParallelTilePass("Rail bridge head track bits", [](TileIndex t) {
 			if (IsBridgeTile(t) && GetTunnelBridgeTransportType(t) == TRANSPORT_RAIL) {
 				SetCustomBridgeHeadTrackBits(t, DiagDirToDiagTrackBits(GetTunnelBridgeDirection(t)));
 				SetBridgeReservationTrackBits(t, HasBit(_m[t].m5, 4) ? DiagDirToDiagTrackBits(GetTunnelBridgeDirection(t)) : TRACK_BIT_NONE);
 				ClrBit(_m[t].m5, 4);
 			}
-		}
+		});
 	}
 
 	if (!SlXvIsFeaturePresent(XSLFI_CUSTOM_BRIDGE_HEADS, 3)) {
 		/* fence/ground type support for custom rail bridges */
-		for (TileIndex t = 0; t < map_size; t++) {
+		stage_timer.ParallelTilePass("Rail bridge head fence bits", [](TileIndex t) {
 			if (IsTileType(t, MP_TUNNELBRIDGE)) SB(_me[t].m7, 6, 2, 0);
-		}
+		});
 	}
 
 	if (SlXvIsFeaturePresent(XSLFI_CUSTOM_BRIDGE_HEADS, 1, 3)) {
@@ -1815,6 +1868,8 @@ bool AfterLoadGame()
 
 	AfterLoadStations();
 
+	stage_timer.Stage("Station tiles and map conversions");
+
 	/* Time starts at 0 instead of 1920.
 	 * Account for this in older games by adding an offset */
 	if (IsSavegameVersionBefore(SLV_31)) {
@@ -1923,9 +1978,13 @@ bool AfterLoadGame()
 		}
 	}
 
+	stage_timer.Stage("Map conversions (middle)");
+
 	/* Check and update house and town values */
 	UpdateHousesAndTowns(gcf_res != GLC_ALL_GOOD, true);
 
+	stage_timer.Stage("Houses and towns");
+
 	if (IsSavegameVersionBefore(SLV_43)) {
 		for (TileIndex t = 0; t < map_size; t++) {
 			if (IsTileType(t, MP_INDUSTRY)) {
@@ -3395,7 +3454,9 @@ bool AfterLoadGame()
 
 	/* Station blocked, wires and pylon flags need to be stored in the map.
 	 * This is done here as the SLV_182 check below needs the blocked status. */
+	stage_timer.Stage("Map conversions (late)");
 	UpdateStationTileCacheFlags(SlXvIsFeatureMissing(XSLFI_STATION_TILE_CACHE_FLAGS));
+	stage_timer.Stage("Station tile cache flags");
 
 	if (IsSavegameVersionBefore(SLV_182)) {
 		/* Aircraft acceleration variable was bonkers */
@@ -3758,11 +3819,11 @@ bool AfterLoadGame()
 
 	if (SlXvIsFeaturePresent(XSLFI_RAIL_AGEING)) {
 		/* remove rail aging data */
-		for (TileIndex t = 0; t < map_size; t++) {
+		stage_timer.ParallelTilePass("Rail ageing removal", [](TileIndex t) {
 			if (IsPlainRailTile(t)) {
 				SB(_me[t].m7, 0, 8, 0);
 			}
-		}
+		});
 	}
 
 	if (SlXvIsFeaturePresent(XSLFI_SPRINGPP)) {
@@ -3812,11 +3873,11 @@ bool AfterLoadGame()
 	}
 	if (SlXvIsFeaturePresent(XSLFI_SIG_TUNNEL_BRIDGE, 1, 5)) {
 		/* entrance and exit signal red/green states now have separate bits */
-		for (TileIndex t = 0; t < map_size; t++) {
+		stage_timer.ParallelTilePass("Signalled tunnel/bridge exit states", [](TileIndex t) {
 			if (IsTileType(t, MP_TUNNELBRIDGE) && GetTunnelBridgeTransportType(t) == TRANSPORT_RAIL && IsTunnelBridgeSignalSimulationExit(t)) {
 				SetTunnelBridgeExitSignalState(t, HasBit(_me[t].m6, 0) ? SIGNAL_STATE_GREEN : SIGNAL_STATE_RED);
 			}
-		}
+		});
 	}
 	if (SlXvIsFeaturePresent(XSLFI_SIG_TUNNEL_BRIDGE, 1, 7)) {
 		/* spacing setting moved to company settings */
@@ -3851,11 +3912,11 @@ bool AfterLoadGame()
 
 	if (SlXvIsFeatureMissing(XSLFI_CUSTOM_BRIDGE_HEADS)) {
 		/* ensure that previously unused custom bridge-head bits are cleared */
-		for (TileIndex t = 0; t < map_size; t++) {
+		stage_timer.ParallelTilePass("Road bridge head bits", [](TileIndex t) {
 			if (IsBridgeTile(t) && GetTunnelBridgeTransportType(t) == TRANSPORT_ROAD) {
 				SB(_m[t].m2, 0, 8, 0);
 			}
-		}
+		});
 	}
 
 	if (IsSavegameVersionBefore(SLV_SHIPS_STOP_IN_LOCKS)) {
@@ -3917,9 +3978,9 @@ bool AfterLoadGame()
 
 	if (IsSavegameVersionBefore(SLV_TREES_WATER_CLASS) && !SlXvIsFeaturePresent(XSLFI_CHUNNEL, 2)) {
 		/* Update water class for trees. */
-		for (TileIndex t = 0; t < map_size; t++) {
+		stage_timer.ParallelTilePass("Tree water class", [](TileIndex t) {
 			if (IsTileType(t, MP_TREES)) SetWaterClass(t, GetTreeGround(t) == TREE_GROUND_SHORE ? WATER_CLASS_SEA : WATER_CLASS_INVALID);
-		}
+		});
 	}
 
 	/* Update structures for multitile docks */
@@ -4451,6 +4512,8 @@ bool AfterLoadGame()
 	 */
 	if (IsSavegameVersionBefore(SLV_164)) FixupTrainLengths();
 
+	stage_timer.Stage("Map conversions (final)");
+
 	InitializeRoadGUI();
 
 	/* This needs to be done after conversion. */
@@ -4465,6 +4528,8 @@ bool AfterLoadGame()
 
 	AfterLoadVehiclesRemoveAnyFoundInvalid();
 
+	stage_timer.Stage("Viewport, road stops and label maps");
+
 	GamelogPrintDebug(1);
 
 	SetupTickRate();
@@ -4473,6 +4538,8 @@ bool AfterLoadGame()
 	/* Restore the signals */
 	ResetSignalHandlers();
 
+	stage_timer.Stage("Windows and caches");
+
 	AfterLoadLinkGraphs();
 
 	AfterLoadTraceRestrict();
@@ -4498,6 +4565,10 @@ bool AfterLoadGame()
 
 	UpdateCargoScalers();
 
+	RebuildAnimatedTileSpeedIndex();
+
+	stage_timer.Stage("Link graphs, vehicle and signal caches");
+
 	if (_networking && !_network_server) {
 		SlProcessVENC();
 
@@ -4545,6 +4616,8 @@ bool AfterLoadGame()
 		c->settings = _settings_client.company;
 	}
 
+	stage_timer.Finish();
+
 	return true;
 }
 
@@ -4591,18 +4664,19 @@ void ReloadNewGRFData()
 	}
 
 	/* Restore correct railtype for all rail tiles.*/
-	const TileIndex map_size = MapSize();
-	for (TileIndex t = 0; t < map_size; t++) {
-		if (GetTileType(t) == MP_RAILWAY ||
-				IsLevelCrossingTile(t) ||
-				IsRailStationTile(t) ||
-				IsRailWaypointTile(t) ||
-				IsRailTunnelBridgeTile(t)) {
-			SetRailType(t, rail_type_translate_map[GetRailType(t)]);
-			RailType secondary = GetTileSecondaryRailTypeIfValid(t);
-			if (secondary != INVALID_RAILTYPE) SetSecondaryRailType(t, rail_type_translate_map[secondary]);
-		}
-	}
+	_general_worker_pool.RunParallelChunks(MapSize(), WORKER_MAP_CHUNK_SIZE, [&](size_t begin, size_t end) {
+		for (TileIndex t = (TileIndex)begin; t < end; t++) {
+			if (GetTileType(t) == MP_RAILWAY ||
+					IsLevelCrossingTile(t) ||
+					IsRailStationTile(t) ||
+					IsRailWaypointTile(t) ||
+					IsRailTunnelBridgeTile(t)) {
+				SetRailType(t, rail_type_translate_map[GetRailType(t)]);
+				RailType secondary = GetTileSecondaryRailTypeIfValid(t);
+				if (secondary != INVALID_RAILTYPE) SetSecondaryRailType(t, rail_type_translate_map[secondary]);
+			}
+		}
+	});
 
 	UpdateExtraAspectsVariable();
 
@@ -32,9 +32,14 @@
 #include "smallmap_colours.h"
 #include "smallmap_gui.h"
 #include "screenshot_gui.h"
+#include "thread.h"
 
 #include "table/strings.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+
 #include "safeguards.h"
 
 static const char * const SCREENSHOT_NAME = "screenshot"; ///< Default filename of a saved screenshot.
@@ -259,6 +264,124 @@ static void PNGAPI png_my_warning(png_structp png_ptr, png_const_charp message)
 	DEBUG(misc, 1, "[libpng] warning: %s - %s", message, (const char *)png_get_error_ptr(png_ptr));
 }
 
+/**
+ * Write a block of rows to the PNG stream.
+ * This arms its own error handler, so that it can be safely called from the encoder thread.
+ * @param png_ptr PNG write struct.
+ * @param buf First row of pixel data.
+ * @param row_bytes Size of each row in bytes.
+ * @param n Number of rows to write.
+ * @return Rows were written successfully.
+ */
+static bool PNGWriteRows(png_structp png_ptr, const uint8_t *buf, size_t row_bytes, uint n)
+{
+	if (setjmp(png_jmpbuf(png_ptr))) return false;
+
+	for (uint i = 0; i != n; i++) {
+		png_write_row(png_ptr, (png_const_bytep)(buf + i * row_bytes));
+	}
+	return true;
+}
+
+/**
+ * Pipeline of row buffers between the screenshot callback and the PNG encoder.
+ * Pixel data is generated on the calling thread, whilst filtering, zlib compression and file output of
+ * previously generated blocks of rows happens on the encoder thread.
+ * Memory use is bounded to #BUFFER_COUNT blocks of rows, regardless of the image size.
+ */
+struct PNGRowPipeline {
+	static const uint BUFFER_COUNT = 3;
+
+	png_structp png_ptr;
+	size_t row_bytes;
+	uint maxlines;
+
+	std::mutex mutex;
+	std::condition_variable ready_cv;    ///< Signalled when a block of rows is ready for encoding, or generation is finished.
+	std::condition_variable free_cv;     ///< Signalled when a block of rows has been encoded, or encoding failed.
+	std::unique_ptr<uint8_t[]> buffers[BUFFER_COUNT];
+	uint lines[BUFFER_COUNT];
+	uint first_ready = 0;                ///< Index of the oldest buffer which is ready for, or being, encoded.
+	uint count_ready = 0;                ///< Number of buffers ready for, or being, encoded.
+	bool finished = false;               ///< All rows have been generated.
+	bool failed = false;                 ///< The encoder failed.
+
+	std::thread encode_thread;
+
+	PNGRowPipeline(png_structp png_ptr, size_t row_bytes, uint maxlines) : png_ptr(png_ptr), row_bytes(row_bytes), maxlines(maxlines)
+	{
+		for (auto &buffer : this->buffers) {
+			buffer = std::make_unique<uint8_t[]>(row_bytes * maxlines);
+		}
+	}
+
+	static void RunThread(PNGRowPipeline *self)
+	{
+		std::unique_lock<std::mutex> lk(self->mutex);
+		while (true) {
+			if (self->count_ready == 0) {
+				if (self->finished) return;
+				self->ready_cv.wait(lk);
+				continue;
+			}
+
+			uint buf = self->first_ready;
+			lk.unlock();
+			bool ok = PNGWriteRows(self->png_ptr, self->buffers[buf].get(), self->row_bytes, self->lines[buf]);
+			lk.lock();
+			if (!ok) {
+				self->failed = true;
+				self->free_cv.notify_one();
+				return;
+			}
+			self->first_ready = (self->first_ready + 1) % BUFFER_COUNT;
+			self->count_ready--;
+			self->free_cv.notify_one();
+		}
+	}
+
+	/**
+	 * Generate all rows of the image and feed them to the encoder thread.
+	 * @param callb Callback function for generating lines of pixels.
+	 * @param userdata User data, passed on to \a callb.
+	 * @param w Width of the image in pixels.
+	 * @param h Height of the image in pixels.
+	 * @return Whether all rows were encoded successfully, or std::nullopt if the encoder thread could not be started.
+	 */
+	std::optional<bool> Run(ScreenshotCallback *callb, void *userdata, uint w, uint h)
+	{
+		if (!StartNewThread(&this->encode_thread, "ottd:png", &PNGRowPipeline::RunThread, this)) {
+			DEBUG(misc, 1, "Failed to start PNG encoder thread, encoding non-threaded");
+			return std::nullopt;
+		}
+
+		uint y = 0;
+		std::unique_lock<std::mutex> lk(this->mutex);
+		while (y != h && !this->failed) {
+			if (this->count_ready == BUFFER_COUNT) {
+				this->free_cv.wait(lk);
+				continue;
+			}
+
+			uint buf = (this->first_ready + this->count_ready) % BUFFER_COUNT;
+			uint n = std::min(h - y, this->maxlines);
+			lk.unlock();
+			callb(userdata, this->buffers[buf].get(), y, w, n);
+			y += n;
+			lk.lock();
+			this->lines[buf] = n;
+			this->count_ready++;
+			if (this->count_ready == 1) this->ready_cv.notify_one();
+		}
+		this->finished = true;
+		this->ready_cv.notify_one();
+		lk.unlock();
+
+		this->encode_thread.join();
+		return !this->failed;
+	}
+};
+
 /**
  * Generic .PNG file image writer.
  * @param name        Filename, including extension.
@@ -396,28 +519,53 @@ static bool MakePNGImage(const char *name, ScreenshotCallback *callb, void *user
 	/* use by default 64k temp memory */
 	maxlines = Clamp(65536 / w, 16, 128);
 
-	/* now generate the bitmap bits */
-	void *buff = CallocT<uint8_t>(static_cast<size_t>(w) * maxlines * bpp); // by default generate 128 lines at a time.
+	/* now generate the bitmap bits, overlapping generation with encoding where possible */
+	std::optional<bool> pipeline_result;
+	if (h > maxlines) {
+		PNGRowPipeline pipeline(png_ptr, static_cast<size_t>(w) * bpp, maxlines);
+		pipeline_result = pipeline.Run(callb, userdata, w, h);
+	}
 
-	y = 0;
-	do {
-		/* determine # lines to write */
-		n = std::min(h - y, maxlines);
+	if (!pipeline_result.has_value()) {
+		void *buff = CallocT<uint8_t>(static_cast<size_t>(w) * maxlines * bpp); // by default generate 128 lines at a time.
 
-		/* render the pixels into the buffer */
-		callb(userdata, buff, y, w, n);
-		y += n;
+		bool ok = true;
+		y = 0;
+		do {
+			/* determine # lines to write */
+			n = std::min(h - y, maxlines);
 
-		/* write them to png */
-		for (i = 0; i != n; i++) {
-			png_write_row(png_ptr, (png_bytep)buff + i * w * bpp);
-		}
-	} while (y != h);
+			/* render the pixels into the buffer */
+			callb(userdata, buff, y, w, n);
+			y += n;
+
+			/* write them to png */
+			if (!PNGWriteRows(png_ptr, (const uint8_t *)buff, static_cast<size_t>(w) * bpp, n)) {
+				ok = false;
+				break;
+			}
+		} while (y != h);
+
+		free(buff);
+		pipeline_result = ok;
+	}
+
+	if (!pipeline_result.value()) {
+		png_destroy_write_struct(&png_ptr, &info_ptr);
+		fclose(f);
+		return false;
+	}
+
+	/* The error handler was last armed by PNGWriteRows, re-arm it for this stack frame */
+	if (setjmp(png_jmpbuf(png_ptr))) {
+		png_destroy_write_struct(&png_ptr, &info_ptr);
+		fclose(f);
+		return false;
+	}
 
 	png_write_end(png_ptr, info_ptr);
 	png_destroy_write_struct(&png_ptr, &info_ptr);
 
-	free(buff);
 	fclose(f);
 	return true;
 }
@@ -12,6 +12,9 @@
 #include "../../debug.h"
 #include "../../script/squirrel.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #include "../../safeguards.h"
 
 /**
@@ -593,13 +596,143 @@ void ScriptList::RemoveItem(SQInteger item)
 
 void ScriptList::InitValues()
 {
-	this->values.clear();
+	/* Sort first and then append in order, this is much cheaper than inserting one at a time into the btree. */
+	std::vector<std::pair<SQInteger, SQInteger>> values;
+	values.reserve(this->items.size());
 	for (const auto &iter : this->items) {
-		this->values.insert(std::make_pair(iter.second, iter.first));
+		values.emplace_back(iter.second, iter.first);
+	}
+	std::sort(values.begin(), values.end());
+
+	this->values.clear();
+	for (const auto &iter : values) {
+		this->values.insert(this->values.end(), iter);
 	}
 	this->values_inited = true;
 }
 
+/**
+ * Rebuild the item map from the value set.
+ */
+void ScriptList::InitItemsFromValues()
+{
+	std::vector<std::pair<SQInteger, SQInteger>> items;
+	items.reserve(this->values.size());
+	for (const auto &iter : this->values) {
+		items.emplace_back(iter.second, iter.first);
+	}
+	std::sort(items.begin(), items.end());
+
+	this->items.clear();
+	for (const auto &iter : items) {
+		this->items.insert(this->items.end(), iter);
+	}
+}
+
+/**
+ * Check whether an iteration is in progress, in which case the sorter needs to be informed of each individual removal or value change.
+ * @return true if an iteration is in progress.
+ */
+bool ScriptList::IsIterating()
+{
+	return this->initialized && !this->sorter->IsEnd();
+}
+
+/**
+ * Remove a number of items from the top or the bottom of the list, in ascending order of the current sorter type.
+ * The removed range is erased in one go, the other index is then either updated for each removed item, or rebuilt from
+ * what remains, whichever is cheaper.
+ * @param count The number of items to remove.
+ * @param top Whether to remove from the top (lowest) instead of the bottom (highest).
+ * @pre !this->IsIterating()
+ */
+void ScriptList::RemoveEnd(SQInteger count, bool top)
+{
+	if (count <= 0) return;
+
+	const SQInteger size = this->Count();
+	if (count >= size) {
+		this->items.clear();
+		this->values.clear();
+		return;
+	}
+	const bool rebuild = count > size / 2;
+
+	auto remove_range = [&](auto &container, auto erase_other, auto rebuild_other) {
+		auto first = container.begin();
+		auto last = container.end();
+		if (top) {
+			last = first;
+			for (SQInteger i = 0; i < count; i++) ++last;
+		} else {
+			first = last;
+			for (SQInteger i = 0; i < count; i++) --first;
+		}
+		if (!rebuild) {
+			for (auto iter = first; iter != last; ++iter) {
+				erase_other(*iter);
+			}
+		}
+		container.erase(first, last);
+		if (rebuild) rebuild_other();
+	};
+
+	switch (this->sorter_type) {
+		default: NOT_REACHED();
+		case SORT_BY_VALUE:
+			if (!this->values_inited) this->InitValues();
+			remove_range(this->values,
+				[&](const auto &value) { this->items.erase(value.second); },
+				[&]() { this->InitItemsFromValues(); });
+			break;
+
+		case SORT_BY_ITEM:
+			remove_range(this->items,
+				[&](const auto &item) {
+					if (this->values_inited) this->values.erase(std::make_pair(item.second, item.first));
+				},
+				[&]() {
+					if (this->values_inited) this->InitValues();
+				});
+			break;
+	}
+}
+
+/**
+ * Remove all items matching a predicate.
+ * When no iteration is in progress the item map and value set are filtered in linear time, instead of removing items one by one.
+ * @param remove Predicate, called with item and value, returning true if the item should be removed.
+ */
+template <typename F>
+void ScriptList::RemoveItemsIf(F remove)
+{
+	if (this->IsIterating()) {
+		for (ScriptListMap::iterator iter = this->items.begin(); iter != this->items.end();) {
+			if (remove(iter->first, iter->second)) {
+				iter = this->RemoveIter(iter);
+			} else {
+				++iter;
+			}
+		}
+		return;
+	}
+
+	ScriptListMap new_items;
+	for (const auto &iter : this->items) {
+		if (!remove(iter.first, iter.second)) new_items.insert(new_items.end(), iter);
+	}
+	if (new_items.size() == this->items.size()) return;
+	this->items.swap(new_items);
+
+	if (this->values_inited) {
+		ScriptListValueSet new_values;
+		for (const auto &iter : this->values) {
+			if (!remove(iter.second, iter.first)) new_values.insert(new_values.end(), iter);
+		}
+		this->values.swap(new_values);
+	}
+}
+
 void ScriptList::InitSorter()
 {
 	if (this->sorter == nullptr) {
@@ -754,40 +887,28 @@ void ScriptList::RemoveAboveValue(SQInteger value)
 {
 	this->modifications++;
 
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = iter; next_iter++;
-		if ((*iter).second > value) this->RemoveItem((*iter).first);
-	}
+	this->RemoveItemsIf([&](SQInteger, SQInteger item_value) { return item_value > value; });
 }
 
 void ScriptList::RemoveBelowValue(SQInteger value)
 {
 	this->modifications++;
 
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = iter; next_iter++;
-		if ((*iter).second < value) this->RemoveItem((*iter).first);
-	}
+	this->RemoveItemsIf([&](SQInteger, SQInteger item_value) { return item_value < value; });
 }
 
 void ScriptList::RemoveBetweenValue(SQInteger start, SQInteger end)
 {
 	this->modifications++;
 
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = iter; next_iter++;
-		if ((*iter).second > start && (*iter).second < end) this->RemoveItem((*iter).first);
-	}
+	this->RemoveItemsIf([&](SQInteger, SQInteger item_value) { return item_value > start && item_value < end; });
 }
 
 void ScriptList::RemoveValue(SQInteger value)
 {
 	this->modifications++;
 
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = iter; next_iter++;
-		if ((*iter).second == value) this->RemoveItem((*iter).first);
-	}
+	this->RemoveItemsIf([&](SQInteger, SQInteger item_value) { return item_value == value; });
 }
 
 void ScriptList::RemoveTop(SQInteger count)
@@ -801,6 +922,11 @@ void ScriptList::RemoveTop(SQInteger count)
 		return;
 	}
 
+	if (!this->IsIterating()) {
+		this->RemoveEnd(count, true);
+		return;
+	}
+
 	switch (this->sorter_type) {
 		default: NOT_REACHED();
 		case SORT_BY_VALUE:
@@ -831,6 +957,11 @@ void ScriptList::RemoveBottom(SQInteger count)
 		return;
 	}
 
+	if (!this->IsIterating()) {
+		this->RemoveEnd(count, false);
+		return;
+	}
+
 	switch (this->sorter_type) {
 		default: NOT_REACHED();
 		case SORT_BY_VALUE:
@@ -870,52 +1001,28 @@ void ScriptList::KeepAboveValue(SQInteger value)
 {
 	this->modifications++;
 
-	for (ScriptListMap::iterator iter = this->items.begin(); iter != this->items.end();) {
-		if (iter->second <= value) {
-			iter = this->RemoveIter(iter);
-		} else {
-			++iter;
-		}
-	}
+	this->RemoveItemsIf([&](SQInteger, SQInteger item_value) { return item_value <= value; });
 }
 
 void ScriptList::KeepBelowValue(SQInteger value)
 {
 	this->modifications++;
 
-	for (ScriptListMap::iterator iter = this->items.begin(); iter != this->items.end();) {
-		if (iter->second >= value) {
-			iter = this->RemoveIter(iter);
-		} else {
-			++iter;
-		}
-	}
+	this->RemoveItemsIf([&](SQInteger, SQInteger item_value) { return item_value >= value; });
 }
 
 void ScriptList::KeepBetweenValue(SQInteger start, SQInteger end)
 {
 	this->modifications++;
 
-	for (ScriptListMap::iterator iter = this->items.begin(); iter != this->items.end();) {
-		if (iter->second <= start || iter->second >= end) {
-			iter = this->RemoveIter(iter);
-		} else {
-			++iter;
-		}
-	}
+	this->RemoveItemsIf([&](SQInteger, SQInteger item_value) { return item_value <= start || item_value >= end; });
 }
 
 void ScriptList::KeepValue(SQInteger value)
 {
 	this->modifications++;
 
-	for (ScriptListMap::iterator iter = this->items.begin(); iter != this->items.end();) {
-		if (iter->second != value) {
-			iter = this->RemoveIter(iter);
-		} else {
-			++iter;
-		}
-	}
+	this->RemoveItemsIf([&](SQInteger, SQInteger item_value) { return item_value != value; });
 }
 
 void ScriptList::KeepTop(SQInteger count)
@@ -1028,6 +1135,13 @@ SQInteger ScriptList::Valuate(HSQUIRRELVM vm)
 	/* Limit the total number of ops that can be consumed by a valuate operation */
 	SQOpsLimiter limiter(vm, MAX_VALUATE_OPS, "valuator function");
 
+	/* If no iteration is in progress, don't update the value set for every single item,
+	 * it is instead rebuilt in one go when it is next required. */
+	if (this->values_inited && !this->IsIterating()) {
+		this->values.clear();
+		this->values_inited = false;
+	}
+
 	/* Push the function to call */
 	sq_push(vm, 2);
 
@@ -54,7 +54,11 @@ private:
 	int modifications;            ///< Number of modification that has been done. To prevent changing data while valuating.
 
 	void InitValues();
+	void InitItemsFromValues();
 	void InitSorter();
+	bool IsIterating();
+	void RemoveEnd(SQInteger count, bool top);
+	template <typename F> void RemoveItemsIf(F remove);
 	void SetIterValue(ScriptListMap::iterator item_iter, SQInteger value);
 	ScriptListMap::iterator RemoveIter(ScriptListMap::iterator item_iter);
 	ScriptListValueSet::iterator RemoveValueIter(ScriptListValueSet::iterator value_iter);
@@ -13,6 +13,7 @@
 #include "script_map.hpp"
 #include "script_station.hpp"
 #include "../../depot_map.h"
+#include "../../group.h"
 #include "../../vehicle_base.h"
 #include "../../vehiclelist_func.h"
 #include "../../train.h"
@@ -33,22 +34,6 @@ struct FrontVehicleOnlyFillListHelper {
 	}
 };
 
-struct VehicleTypeFrontVehicleOnlyFillListHelper {
-	using IterType = Vehicle;
-
-	::VehicleType vt;
-
-	auto Iterate()
-	{
-		return Vehicle::IterateTypeFrontOnly(this->vt);
-	}
-
-	int OpcodeCharge(int item_count)
-	{
-		return item_count / 2;
-	}
-};
-
 ScriptVehicleList::ScriptVehicleList(HSQUIRRELVM vm)
 {
 	EnforceDeityOrCompanyModeValid_Void();
@@ -139,12 +124,10 @@ ScriptVehicleList_Group::ScriptVehicleList_Group(GroupID group_id)
 	EnforceCompanyModeValid_Void();
 	if (!ScriptGroup::IsValidGroup((ScriptGroup::GroupID)group_id)) return;
 
-	CompanyID owner = ScriptObject::GetCompany();
-
-	ScriptList::FillListT<FrontVehicleOnlyFillListHelper>({}, this,
-		[owner](const Vehicle *v) { return v->owner == owner && v->IsPrimaryVehicle(); },
-		[group_id](const Vehicle *v) { return v->group_id == group_id; }
-	);
+	const ::Group *g = ::Group::Get(group_id);
+	for (VehicleID id : g->statistics.vehicles) {
+		this->AddItem(id);
+	}
 }
 
 ScriptVehicleList_DefaultGroup::ScriptVehicleList_DefaultGroup(ScriptVehicle::VehicleType vehicle_type)
@@ -152,10 +135,8 @@ ScriptVehicleList_DefaultGroup::ScriptVehicleList_DefaultGroup(ScriptVehicle::Ve
 	EnforceCompanyModeValid_Void();
 	if (vehicle_type < ScriptVehicle::VT_RAIL || vehicle_type > ScriptVehicle::VT_AIR) return;
 
-	CompanyID owner = ScriptObject::GetCompany();
-
-	ScriptList::FillListT<VehicleTypeFrontVehicleOnlyFillListHelper>({ (::VehicleType)vehicle_type  }, this,
-		[owner](const Vehicle *v) { return v->owner == owner && v->IsPrimaryVehicle(); },
-		[](const Vehicle *v) { return v->group_id == ScriptGroup::GROUP_DEFAULT; }
-	);
+	const GroupStatistics &stats = GroupStatistics::Get(ScriptObject::GetCompany(), DEFAULT_GROUP, (::VehicleType)vehicle_type);
+	for (VehicleID id : stats.vehicles) {
+		this->AddItem(id);
+	}
 }
@@ -214,6 +214,7 @@ struct GUISettings : public TimeSettings {
 	uint32_t    autosave_interval;                               ///< how often should we do autosaves?
 	bool        autosave_realtime;                               ///< autosaves based on real elapsed time (with pause handling)
 	bool        threaded_saves;                                  ///< should we do threaded saves?
+	bool        forked_autosave;                                 ///< should autosaves of a dedicated server be written by a forked process? (Linux only)
 	bool        keep_all_autosave;                               ///< name the autosave in a different way
 	bool        autosave_on_exit;                                ///< save an autosave when you quit the game, but do not ask "Do you really want to quit?"
 	bool        autosave_on_network_disconnect;                  ///< save an autosave when you get disconnected from a network game with an error?
@@ -437,6 +438,7 @@ struct NetworkSettings {
 	uint16_t      server_port;                            ///< port the server listens on
 	uint16_t      server_admin_port;                      ///< port the server listens on for the admin network
 	bool        server_admin_chat;                        ///< allow private chat for the server to be distributed to the admin network
+	uint16_t      admin_performance_interval;             ///< interval in ticks between performance samples sent to the admin network
 	ServerGameType server_game_type;                      ///< Server type: local / public / invite-only.
 	std::string server_invite_code;                       ///< Invite code to use when registering as server.
 	std::string server_invite_code_secret;                ///< Secret to proof we got this invite code from the Game Coordinator.
@@ -699,6 +701,7 @@ struct VehicleSettings {
 	uint16_t through_load_speed_limit;         ///< maximum speed for through load
 	uint16_t rail_depot_speed_limit;           ///< maximum speed entering/existing rail depots
 	bool     non_leading_engines_keep_name;    ///< allow engines moved to a non-leading position to retain their custom name
+	uint16_t max_template_replacements_per_tick; ///< maximum number of template replacements per tick, 0 = unlimited
 };
 
 /** Settings related to the economy. */
@@ -720,6 +723,7 @@ struct EconomySettings {
 	bool     spawn_primary_industry_only;    ///< only spawn primary industried
 	int8_t   town_growth_rate;               ///< town growth rate
 	uint8_t  town_growth_cargo_transported;  ///< percentage of town growth rate which depends on proportion of transported cargo in the last month
+	bool     town_growth_frontier;           ///< start town growth attempts from road tiles at the edge of the town instead of the town centre
 	bool     town_zone_calc_mode;            ///< calc mode for town zones
 	uint16_t town_zone_0_mult;               ///< multiplier for the size of town zone 0
 	uint16_t town_zone_1_mult;               ///< multiplier for the size of town zone 1
@@ -183,6 +183,11 @@ static void Save_CAPA()
 {
 	SaveLoadTableData slt = SlTableHeader(GetCargoPacketDesc());
 
+	/* Vehicle cargo aging may be deferred, apply it so that the saved periods in transit are correct. */
+	for (const Vehicle *v : Vehicle::Iterate()) {
+		v->cargo.ApplyPendingAging();
+	}
+
 	for (CargoPacket *cp : CargoPacket::Iterate()) {
 		SlSetArrayIndex(cp->index);
 		SlObjectSaveFiltered(cp, slt);
@@ -137,7 +137,7 @@ const SlxiSubChunkInfo _sl_xv_sub_chunk_infos[] = {
 	{ XSLFI_GAME_EVENTS,                      XSCF_NULL,                1,   1, "game_events",                      nullptr, nullptr, nullptr          },
 	{ XSLFI_ROAD_LAYOUT_CHANGE_CTR,           XSCF_NULL,                1,   1, "road_layout_change_ctr",           nullptr, nullptr, nullptr          },
 	{ XSLFI_TOWN_CARGO_MATRIX,                XSCF_NULL,                0,   1, "town_cargo_matrix",                nullptr, nullptr, nullptr          },
-	{ XSLFI_STATE_CHECKSUM,                   XSCF_NULL,                1,   1, "state_checksum",                   nullptr, nullptr, nullptr          },
+	{ XSLFI_STATE_CHECKSUM,                   XSCF_NULL,                2,   2, "state_checksum",                   nullptr, nullptr, nullptr          },
 	{ XSLFI_DEBUG,                            XSCF_IGNORABLE_ALL,       2,   2, "debug",                            nullptr, nullptr, "DBGD"           },
 	{ XSLFI_FLOW_STAT_FLAGS,                  XSCF_NULL,                1,   1, "flow_stat_flags",                  nullptr, nullptr, nullptr          },
 	{ XSLFI_SPEED_RESTRICTION,                XSCF_NULL,                2,   2, "speed_restriction",                nullptr, nullptr, "VESR"           },
@@ -195,6 +195,7 @@ const SlxiSubChunkInfo _sl_xv_sub_chunk_infos[] = {
 	{ XSLFI_STATION_TILE_CACHE_FLAGS,         XSCF_IGNORABLE_ALL,       1,   1, "station_tile_cache_flags",         saveSTC, loadSTC, nullptr          },
 	{ XSLFI_INDUSTRY_CARGO_TOTALS,            XSCF_NULL,                1,   1, "industry_cargo_totals",            nullptr, nullptr, nullptr          },
 	{ XSLFI_SIGNAL_SPECIAL_PROPAGATION_FLAG,  XSCF_IGNORABLE_ALL,       1,   1, "signal_special_propagation_flag",  nullptr, nullptr, nullptr          },
+	{ XSLFI_TOWN_GROWTH_FRONTIER,             XSCF_IGNORABLE_UNKNOWN,   1,   1, "town_growth_frontier",             nullptr, nullptr, nullptr          },
 
 	{ XSLFI_SCRIPT_INT64,                     XSCF_NULL,                1,   1, "script_int64",                     nullptr, nullptr, nullptr          },
 	{ XSLFI_U64_TICK_COUNTER,                 XSCF_NULL,                1,   1, "u64_tick_counter",                 nullptr, nullptr, nullptr          },
@@ -86,7 +86,7 @@ enum SlXvFeatureIndex {
 	XSLFI_GAME_EVENTS,                            ///< Game event flags
 	XSLFI_ROAD_LAYOUT_CHANGE_CTR,                 ///< Road layout change counter
 	XSLFI_TOWN_CARGO_MATRIX,                      ///< Town cargo matrix savegame format changes (now obsolete)
-	XSLFI_STATE_CHECKSUM,                         ///< State checksum
+	XSLFI_STATE_CHECKSUM,                         ///< State checksum, 2: per-subsystem state checksums
 	XSLFI_DEBUG,                                  ///< Debugging info
 	XSLFI_FLOW_STAT_FLAGS,                        ///< FlowStat flags
 	XSLFI_SPEED_RESTRICTION,                      ///< Train speed restrictions
@@ -144,6 +144,7 @@ enum SlXvFeatureIndex {
 	XSLFI_STATION_TILE_CACHE_FLAGS,               ///< Station tile cache flags
 	XSLFI_INDUSTRY_CARGO_TOTALS,                  ///< Industry cargo totals are 32 bit
 	XSLFI_SIGNAL_SPECIAL_PROPAGATION_FLAG,        ///< Signal special propagation flag
+	XSLFI_TOWN_GROWTH_FRONTIER,                   ///< Town growth frontier tiles
 
 	XSLFI_SCRIPT_INT64,                           ///< See: SLV_SCRIPT_INT64
 	XSLFI_U64_TICK_COUNTER,                       ///< See: SLV_U64_TICK_COUNTER
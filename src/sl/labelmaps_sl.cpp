@@ -10,6 +10,7 @@
 #include "../stdafx.h"
 #include "../station_map.h"
 #include "../tunnelbridge_map.h"
+#include "../worker_thread.h"
 
 #include "saveload.h"
 #include "saveload_internal.h"
@@ -59,34 +60,37 @@ void AfterLoadLabelMaps()
 			if (secondary != INVALID_RAILTYPE) SetSecondaryRailType(t, railtype_conversion_map[secondary]);
 		};
 
-		for (TileIndex t = 0; t < MapSize(); t++) {
-			switch (GetTileType(t)) {
-				case MP_RAILWAY:
-					convert(t);
-					break;
-
-				case MP_ROAD:
-					if (IsLevelCrossing(t)) {
-						convert(t);
-					}
-					break;
-
-				case MP_STATION:
-					if (HasStationRail(t)) {
+		/* Each tile is converted independently, so this can be split across the worker threads. */
+		_general_worker_pool.RunParallelChunks(MapSize(), WORKER_MAP_CHUNK_SIZE, [&](size_t begin, size_t end) {
+			for (TileIndex t = (TileIndex)begin; t < end; t++) {
+				switch (GetTileType(t)) {
+					case MP_RAILWAY:
 						convert(t);
-					}
-					break;
-
-				case MP_TUNNELBRIDGE:
-					if (GetTunnelBridgeTransportType(t) == TRANSPORT_RAIL) {
-						convert(t);
-					}
-					break;
-
-				default:
-					break;
+						break;
+
+					case MP_ROAD:
+						if (IsLevelCrossing(t)) {
+							convert(t);
+						}
+						break;
+
+					case MP_STATION:
+						if (HasStationRail(t)) {
+							convert(t);
+						}
+						break;
+
+					case MP_TUNNELBRIDGE:
+						if (GetTunnelBridgeTransportType(t) == TRANSPORT_RAIL) {
+							convert(t);
+						}
+						break;
+
+					default:
+						break;
+				}
 			}
-		}
+		});
 	}
 
 	ResetLabelMaps();
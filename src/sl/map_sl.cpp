@@ -247,56 +247,80 @@ static void Load_WMAP()
 	}
 }
 
+/** Number of tiles in each block of map data which is filled on a worker thread. */
+static constexpr uint SAVE_MAP_BLOCK_TILES = 1 << 18;
+
+/**
+ * Write map data for all tiles into the savegame, in blocks which are filled on worker threads while the following chunks are saved.
+ * @param bytes_per_tile Number of bytes written per tile.
+ * @param fill Function which writes the data of tiles [begin, end) into a buffer.
+ */
+template <typename F>
+static void SaveMapDataDeferred(size_t bytes_per_tile, F fill)
+{
+	MemoryDumper *dumper = MemoryDumper::GetCurrent();
+	const uint size = MapSize();
+	for (uint begin = 0; begin < size; begin += SAVE_MAP_BLOCK_TILES) {
+		const uint end = std::min(begin + SAVE_MAP_BLOCK_TILES, size);
+		dumper->WriteDeferredBytes((end - begin) * bytes_per_tile, [fill, begin, end](uint8_t *buf) {
+			fill(buf, begin, end);
+		});
+	}
+}
+
 static void Save_WMAP()
 {
 	static_assert(sizeof(Tile) == 8);
 	static_assert(sizeof(TileExtended) == 4);
 	assert(_sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] == 2);
 
-	MemoryDumper *dumper = MemoryDumper::GetCurrent();
 	const TileIndex size = MapSize();
 	SlSetLength(size * 12);
 
 #if TTD_ENDIAN == TTD_LITTLE_ENDIAN
-	dumper->CopyBytes((uint8_t *) _m, size * 8);
-	dumper->CopyBytes((uint8_t *) _me, size * 4);
+	SaveMapDataDeferred(8, [](uint8_t *buf, uint begin, uint end) {
+		memcpy(buf, _m + begin, (end - begin) * 8);
+	});
+	SaveMapDataDeferred(4, [](uint8_t *buf, uint begin, uint end) {
+		memcpy(buf, _me + begin, (end - begin) * 4);
+	});
 #else
-	Tile *m_start = _m;
-	Tile *m_end = _m + size;
-	for (Tile *m = m_start; m != m_end; m++) {
-		RawMemoryDumper dump = dumper->RawWriteBytes(8);
-		dump.RawWriteByte(m->type);
-		dump.RawWriteByte(m->height);
-		dump.RawWriteByte(GB(m->m2, 0, 8));
-		dump.RawWriteByte(GB(m->m2, 8, 8));
-		dump.RawWriteByte(m->m1);
-		dump.RawWriteByte(m->m3);
-		dump.RawWriteByte(m->m4);
-		dump.RawWriteByte(m->m5);
-	}
-	TileExtended *me_start = _me;
-	TileExtended *me_end = _me + size;
-	for (TileExtended *me = me_start; me != me_end; me++) {
-		RawMemoryDumper dump = dumper->RawWriteBytes(4);
-		dump.RawWriteByte(me->m6);
-		dump.RawWriteByte(me->m7);
-		dump.RawWriteByte(GB(me->m8, 0, 8));
-		dump.RawWriteByte(GB(me->m8, 8, 8));
-	}
+	SaveMapDataDeferred(8, [](uint8_t *buf, uint begin, uint end) {
+		RawMemoryDumper dump(buf);
+		for (Tile *m = _m + begin; m != _m + end; m++) {
+			dump.RawWriteByte(m->type);
+			dump.RawWriteByte(m->height);
+			dump.RawWriteByte(GB(m->m2, 0, 8));
+			dump.RawWriteByte(GB(m->m2, 8, 8));
+			dump.RawWriteByte(m->m1);
+			dump.RawWriteByte(m->m3);
+			dump.RawWriteByte(m->m4);
+			dump.RawWriteByte(m->m5);
+		}
+	});
+	SaveMapDataDeferred(4, [](uint8_t *buf, uint begin, uint end) {
+		RawMemoryDumper dump(buf);
+		for (TileExtended *me = _me + begin; me != _me + end; me++) {
+			dump.RawWriteByte(me->m6);
+			dump.RawWriteByte(me->m7);
+			dump.RawWriteByte(GB(me->m8, 0, 8));
+			dump.RawWriteByte(GB(me->m8, 8, 8));
+		}
+	});
 #endif
 }
 
 struct MapTileReader {
 	Tile *m;
 
-	MapTileReader() { this->m = _m; }
+	MapTileReader(uint begin) { this->m = _m + begin; }
 	Tile *Next() { return this->m++; }
 };
 
 struct MapTileExtendedReader {
 	TileExtended *me;
 
-	MapTileExtendedReader() { this->me = _me; }
+	MapTileExtendedReader(uint begin) { this->me = _me + begin; }
 	TileExtended *Next() { return this->me++; }
 };
 
@@ -360,16 +384,17 @@ static void Save_MAP()
 	TileIndex size = MapSize();
 	SlSetLength(size * sizeof(typename T::FieldT));
 
-	T map_reader{};
-	if constexpr (std::is_same_v<typename T::FieldT, uint8_t>) {
-		MemoryDumper::GetCurrent()->WriteBytesFromHandler(size, [&]() -> uint8_t {
-			return map_reader.GetNextField();
-		});
-	} else {
-		MemoryDumper::GetCurrent()->WriteUint16sFromHandler(size, [&]() -> uint16_t {
-			return map_reader.GetNextField();
-		});
-	}
+	SaveMapDataDeferred(sizeof(typename T::FieldT), [](uint8_t *buf, uint begin, uint end) {
+		T map_reader{begin};
+		for (uint i = begin; i < end; i++) {
+			if constexpr (std::is_same_v<typename T::FieldT, uint8_t>) {
+				*buf++ = map_reader.GetNextField();
+			} else {
+				SlSerialise::RawWriteUint16At(buf, map_reader.GetNextField());
+				buf += 2;
+			}
+		}
+	});
 }
 
 static ChunkSaveLoadSpecialOpResult Special_WMAP(uint32_t chunk_id, ChunkSaveLoadSpecialOp op)
@@ -126,6 +126,7 @@ static const NamedSaveLoad _date_desc[] = {
 	NSLT("calendar_sub_date_fract",     SLEG_CONDVAR_X(CalTime::Detail::now.sub_date_fract,     SLE_UINT16,                   SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_VARIABLE_DAY_LENGTH, 5))),
 	NSLT("economy_years_elapsed",       SLEG_CONDVAR_X(EconTime::Detail::years_elapsed,          SLE_INT32,                   SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_VARIABLE_DAY_LENGTH, 6))),
 	NSLT("period_display_offset",       SLEG_CONDVAR_X(EconTime::Detail::period_display_offset,  SLE_INT32,                   SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_VARIABLE_DAY_LENGTH, 6))),
+	NSLT("state_subsystem_checksums",   SLEG_CONDARR_X(_state_subsystem_checksums,              SLE_UINT64, SCS_END,          SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_STATE_CHECKSUM, 2))),
 };
 
 static const NamedSaveLoad _date_check_desc[] = {
@@ -173,6 +174,8 @@ static void Save_DATE()
 
 static void Load_DATE()
 {
+	/* Savegames without per-subsystem checksums start from zero, not from the checksums of the previous game */
+	std::fill(std::begin(_state_subsystem_checksums), std::end(_state_subsystem_checksums), 0);
 	SlLoadTableOrRiffFiltered(_date_desc);
 }
 
@@ -57,6 +57,10 @@
 #ifndef _WIN32
 #	include <unistd.h>
 #endif /* _WIN32 */
+#if defined(__linux__)
+#	include <fcntl.h>
+#	include <sys/wait.h>
+#endif
 
 #include "../tbtr_template_vehicle.h"
 #include "../3rdparty/cpp-btree/btree_map.h"
@@ -71,6 +75,7 @@
 #include <vector>
 
 #include "../thread.h"
+#include "../worker_thread.h"
 #include <mutex>
 #include <condition_variable>
 
@@ -159,10 +164,31 @@ void ReadBuffer::AcquireBytes(size_t bytes)
 	this->bufe = this->buf + total;
 }
 
+/** State of the blocks of a MemoryDumper which are being filled on worker threads. */
+struct MemoryDumperDeferredWrites {
+	std::mutex lock;
+	std::condition_variable done_cv;
+	size_t pending = 0;
+};
+
+MemoryDumper::MemoryDumper()
+{
+	const size_t size = 8192;
+	this->autolen_buf = CallocT<uint8_t>(size);
+	this->autolen_buf_end = this->autolen_buf + size;
+}
+
+MemoryDumper::~MemoryDumper()
+{
+	/* Worker threads may still be writing into the blocks if saving failed */
+	this->WaitForDeferredWrites();
+	free(this->autolen_buf);
+}
+
 void MemoryDumper::FinaliseBlock()
 {
 	assert(this->saved_buf == nullptr);
-	if (!this->blocks.empty()) {
+	if (this->bufe != nullptr) {
 		size_t s = MEMORY_CHUNK_SIZE - (this->bufe - this->buf);
 		this->blocks.back().size = s;
 		this->completed_block_bytes += s;
@@ -187,6 +213,51 @@ void MemoryDumper::AllocateBuffer()
 	this->bufe = this->buf + MEMORY_CHUNK_SIZE;
 }
 
+/**
+ * Append a block of bytes to the dump, which is filled on a worker thread while saving continues.
+ * The data read by \a fill must not be changed until WaitForDeferredWrites() has returned.
+ * @param length Number of bytes in the block.
+ * @param fill Function to fill the block, this is called with a pointer to the start of the block.
+ */
+void MemoryDumper::WriteDeferredBytes(size_t length, std::function<void(uint8_t *)> fill)
+{
+	if (length == 0) return;
+
+	this->FinaliseBlock();
+	uint8_t *data = MallocT<uint8_t>(length);
+	this->blocks.emplace_back(data).size = length;
+	this->completed_block_bytes += length;
+
+	if (this->deferred_writes == nullptr) this->deferred_writes = std::make_unique<MemoryDumperDeferredWrites>();
+	{
+		std::lock_guard<std::mutex> lk(this->deferred_writes->lock);
+		this->deferred_writes->pending++;
+	}
+
+	struct DeferredWriteJob {
+		MemoryDumperDeferredWrites *state;
+		std::function<void(uint8_t *)> fill;
+		uint8_t *data;
+	};
+	_general_worker_pool.EnqueueJob([](void *data1, void *, void *) {
+		std::unique_ptr<DeferredWriteJob> job(static_cast<DeferredWriteJob *>(data1));
+		job->fill(job->data);
+
+		std::lock_guard<std::mutex> lk(job->state->lock);
+		job->state->pending--;
+		if (job->state->pending == 0) job->state->done_cv.notify_all();
+	}, new DeferredWriteJob{ this->deferred_writes.get(), std::move(fill), data });
+}
+
+/** Wait for all blocks added by WriteDeferredBytes() to be filled. */
+void MemoryDumper::WaitForDeferredWrites()
+{
+	if (this->deferred_writes == nullptr) return;
+
+	std::unique_lock<std::mutex> lk(this->deferred_writes->lock);
+	this->deferred_writes->done_cv.wait(lk, [&]() { return this->deferred_writes->pending == 0; });
+}
+
 /**
  * Flush this dumper into a writer.
  * @param writer The filter we want to use.
@@ -590,12 +661,69 @@ static void SetAsyncSaveFinish(AsyncSaveFinishProc proc)
 	_async_save_thread.SetAsyncSaveFinish(proc);
 }
 
+#if defined(__linux__)
+/** State of an autosave which is being written by a forked child process. */
+struct ForkedSave {
+	pid_t pid = -1;      ///< Process ID of the child process, or -1 if there is no forked save in progress.
+	int result_fd = -1;  ///< Read end of the pipe which the child process writes its result to.
+	std::string result;  ///< Result received so far: a status byte followed by the error message, if any.
+	std::string filename;
+
+	bool IsInProgress() const { return this->pid != -1; }
+
+	/**
+	 * Read the result of the child process, and report it once the child process has exited.
+	 * @param wait Whether to block until the child process has finished.
+	 */
+	void Process(bool wait)
+	{
+		if (!this->IsInProgress()) return;
+
+		char buf[256];
+		while (true) {
+			ssize_t len = read(this->result_fd, buf, sizeof(buf));
+			if (len > 0) {
+				this->result.append(buf, len);
+				continue;
+			}
+			if (len < 0 && errno == EINTR) continue;
+			if (len < 0 && errno == EAGAIN) {
+				if (!wait) return;
+				fcntl(this->result_fd, F_SETFL, fcntl(this->result_fd, F_GETFL) & ~O_NONBLOCK);
+				continue;
+			}
+			break;
+		}
+
+		/* The write end of the pipe has been closed, so the child process has exited or is about to exit */
+		close(this->result_fd);
+		int status = 0;
+		while (waitpid(this->pid, &status, 0) < 0 && errno == EINTR) {}
+		this->pid = -1;
+		this->result_fd = -1;
+
+		if (!this->result.empty() && this->result[0] == SL_OK && WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+			DEBUG(sl, 2, "Forked autosave to '%s' finished", this->filename.c_str());
+		} else {
+			const char *error = this->result.size() > 1 ? this->result.c_str() + 1 : "child process failed";
+			DEBUG(sl, 0, "Forked autosave to '%s' failed: %s", this->filename.c_str(), error);
+			ShowErrorMessage(STR_ERROR_AUTOSAVE_FAILED, INVALID_STRING_ID, WL_ERROR);
+		}
+		this->result.clear();
+	}
+};
+static ForkedSave _forked_save;
+#endif
+
 /**
  * Handle async save finishes.
  */
 void ProcessAsyncSaveFinish()
 {
 	_async_save_thread.ProcessAsyncSaveFinish();
+#if defined(__linux__)
+	_forked_save.Process(false);
+#endif
 }
 
 /**
@@ -2937,6 +3065,9 @@ static void SlSaveChunks()
 
 	/* Terminator */
 	SlWriteUint32(0);
+
+	/* Map chunks are filled in on worker threads, the map must not change until these are done */
+	_sl.dumper->WaitForDeferredWrites();
 }
 
 /**
@@ -3875,6 +4006,14 @@ void WaitTillSaved()
 	_async_save_thread.WaitTillSaved();
 }
 
+/** Wait for an autosave which is being written by a forked child process, if any. */
+void WaitTillForkedSaved()
+{
+#if defined(__linux__)
+	_forked_save.Process(true);
+#endif
+}
+
 /**
  * Actually perform the saving of the savegame.
  * General tactics is to first save the game to memory, then write it to file
@@ -4413,6 +4552,73 @@ SaveOrLoadResult SaveOrLoad(const std::string &filename, SaveLoadOperation fop,
 	}
 }
 
+#if defined(__linux__)
+/**
+ * Create an autosave in a forked child process, which writes the savegame from its copy-on-write
+ * image of the game state while the game continues in this process.
+ * @param filename The file name of the autosave.
+ * @return True if the autosave was started or skipped, false if it should be done in this process instead.
+ */
+static bool DoForkedAutosave(const std::string &filename)
+{
+	if (_forked_save.IsInProgress()) {
+		_forked_save.Process(false);
+		if (_forked_save.IsInProgress()) {
+			DEBUG(sl, 1, "Previous forked autosave is still in progress, skipping autosave to '%s'", filename.c_str());
+			return true;
+		}
+	}
+
+	/* No save thread may be running when forking */
+	WaitTillSaved();
+
+	int fds[2];
+	if (pipe2(fds, O_CLOEXEC) != 0) {
+		DEBUG(sl, 0, "Forked autosave: pipe2 failed: %s", strerror(errno));
+		return false;
+	}
+
+	pid_t pid = fork();
+	if (pid < 0) {
+		DEBUG(sl, 0, "Forked autosave: fork failed: %s", strerror(errno));
+		close(fds[0]);
+		close(fds[1]);
+		return false;
+	}
+
+	if (pid == 0) {
+		/* Child process, only this thread exists here */
+		close(fds[0]);
+		_general_worker_pool.DetachAfterFork();
+
+		std::string result;
+		result.push_back(SaveOrLoad(filename, SLO_SAVE, DFT_GAME_FILE, AUTOSAVE_DIR, false, SMF_ZSTD_OK));
+		if (result[0] != SL_OK) result += strip_leading_colours(GetString(GetSaveLoadErrorType())) + GetString(GetSaveLoadErrorMessage());
+
+		const char *data = result.data();
+		size_t remaining = result.size();
+		while (remaining > 0) {
+			ssize_t written = write(fds[1], data, remaining);
+			if (written < 0 && errno == EINTR) continue;
+			if (written <= 0) break;
+			data += written;
+			remaining -= written;
+		}
+
+		/* Don't run any exit handlers of the parent process */
+		_exit(result[0] == SL_OK ? 0 : 1);
+	}
+
+	close(fds[1]);
+	fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+	_forked_save.pid = pid;
+	_forked_save.result_fd = fds[0];
+	_forked_save.filename = filename;
+	DEBUG(sl, 2, "Forked autosave to '%s' started in process %d", filename.c_str(), (int)pid);
+	return true;
+}
+#endif
+
 /**
  * Create an autosave or netsave.
  * @param counter A reference to the counter variable to be used for rotating the file name.
@@ -4435,6 +4641,9 @@ void DoAutoOrNetsave(FiosNumberedSaveName &counter, bool threaded, FiosNumberedS
 	}
 
 	DEBUG(sl, 2, "Autosaving to '%s'", filename.c_str());
+#if defined(__linux__)
+	if (_network_dedicated && _settings_client.gui.forked_autosave && DoForkedAutosave(filename)) return;
+#endif
 	if (SaveOrLoad(filename, SLO_SAVE, DFT_GAME_FILE, AUTOSAVE_DIR, threaded, SMF_ZSTD_OK) != SL_OK) {
 		ShowErrorMessage(STR_ERROR_AUTOSAVE_FAILED, INVALID_STRING_ID, WL_ERROR);
 	}
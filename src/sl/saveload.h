@@ -72,6 +72,7 @@ StringID GetSaveLoadErrorType();
 StringID GetSaveLoadErrorMessage();
 SaveOrLoadResult SaveOrLoad(const std::string &filename, SaveLoadOperation fop, DetailedFileType dft, Subdirectory sb, bool threaded = true, SaveModeFlags flags = SMF_NONE);
 void WaitTillSaved();
+void WaitTillForkedSaved();
 void ProcessAsyncSaveFinish();
 void DoExitSave();
 
@@ -15,11 +15,14 @@
 #include "../core/endian_func.hpp"
 #include "../core/math_func.hpp"
 
+#include <functional>
+#include <memory>
 #include <vector>
 #include <utility>
 
 struct LoadFilter;
 struct SaveFilter;
+struct MemoryDumperDeferredWrites;
 
 /** Save in chunks of 128 KiB. */
 static const size_t MEMORY_CHUNK_SIZE = 128 * 1024;
@@ -309,17 +312,10 @@ struct MemoryDumper {
 	uint8_t *saved_buf = nullptr;
 	uint8_t *saved_bufe = nullptr;
 
-	MemoryDumper()
-	{
-		const size_t size = 8192;
-		this->autolen_buf = CallocT<uint8_t>(size);
-		this->autolen_buf_end = this->autolen_buf + size;
-	}
+	std::unique_ptr<MemoryDumperDeferredWrites> deferred_writes; ///< Blocks being filled on worker threads.
 
-	~MemoryDumper()
-	{
-		free(this->autolen_buf);
-	}
+	MemoryDumper();
+	~MemoryDumper();
 
 	static MemoryDumper *GetCurrent();
 
@@ -422,6 +418,9 @@ struct MemoryDumper {
 	}
 
 
+	void WriteDeferredBytes(size_t length, std::function<void(uint8_t *)> fill);
+	void WaitForDeferredWrites();
+
 	void Flush(SaveFilter &writer);
 	size_t GetSize() const;
 	size_t GetWriteOffsetGeneric() const;
@@ -346,6 +346,7 @@ static const NamedSaveLoad _town_desc[] = {
 	NSL("", SLE_CONDVAR_X(Town, override_values,     SLE_UINT8, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_TOWN_SETTING_OVERRIDE))),
 	NSL("", SLE_CONDVAR_X(Town, build_tunnels,       SLE_UINT8, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_TOWN_SETTING_OVERRIDE))),
 	NSL("", SLE_CONDVAR_X(Town, max_road_slope,      SLE_UINT8, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_TOWN_SETTING_OVERRIDE))),
+	NSL("growth_frontier", SLE_CONDVARVEC_X(Town, growth_frontier, SLE_UINT32, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_TOWN_GROWTH_FRONTIER))),
 
 	NSLT_STRUCTLIST<TownSuppliedStructHandler>("supplied"),
 	NSLT_STRUCTLIST<TownReceivedStructHandler>("received"),
@@ -394,6 +395,7 @@ static void Load_TOWN()
 	while ((index = SlIterateArray()) != -1) {
 		Town *t = new (index) Town();
 		SlObjectLoadFiltered(t, slt);
+		t->growth_frontier_tiles.insert(t->growth_frontier.begin(), t->growth_frontier.end());
 
 		if (t->townnamegrfid == 0 && !IsInsideMM(t->townnametype, SPECSTR_TOWNNAME_START, SPECSTR_TOWNNAME_LAST + 1) && GetStringTab(t->townnametype) != TEXT_TAB_OLD_CUSTOM) {
 			SlErrorCorrupt("Invalid town name generator");
@@ -604,14 +604,8 @@ static void *ReadSprite(const SpriteCache *sc, SpriteID id, SpriteType sprite_ty
 	return encoder->Encode(sprite, allocator);
 }
 
-struct GrfSpriteOffset {
-	size_t file_pos;
-	uint count;
-	uint16_t control_flags;
-};
-
 /** Map from sprite numbers to position in the GRF file. */
-static btree::btree_map<uint32_t, GrfSpriteOffset> _grf_sprite_offsets;
+static GrfSpriteOffsets _grf_sprite_offsets;
 
 /**
  * Get the file offset for a specific sprite in the sprite section of a GRF.
@@ -625,12 +619,14 @@ size_t GetGRFSpriteOffset(uint32_t id)
 }
 
 /**
- * Parse the sprite section of GRFs.
- * @param container_version Container version of the GRF we're currently processing.
+ * Parse the sprite section of a GRF into the given map.
+ * This does not use any global state, and so may be used on a file which is not the one currently being processed.
+ * @param file GRF to parse, positioned just after the container header.
+ * @param offsets Map to fill with the positions of the sprites.
  */
-void ReadGRFSpriteOffsets(SpriteFile &file)
+void ReadGRFSpriteOffsets(SpriteFile &file, GrfSpriteOffsets &offsets)
 {
-	_grf_sprite_offsets.clear();
+	offsets.clear();
 
 	if (file.GetContainerVersion() >= 2) {
 		/* Seek to sprite section of the GRF. */
@@ -645,7 +641,7 @@ void ReadGRFSpriteOffsets(SpriteFile &file)
 		uint32_t id, prev_id = 0;
 		while ((id = file.ReadDword()) != 0) {
 			if (id != prev_id) {
-				_grf_sprite_offsets[prev_id] = offset;
+				offsets[prev_id] = offset;
 				offset.file_pos = file.GetPos() - 4;
 				offset.count = 0;
 				offset.control_flags = 0;
@@ -667,13 +663,35 @@ void ReadGRFSpriteOffsets(SpriteFile &file)
 			}
 			file.SkipBytes(length);
 		}
-		if (prev_id != 0) _grf_sprite_offsets[prev_id] = offset;
+		if (prev_id != 0) offsets[prev_id] = offset;
 
 		/* Continue processing the data section. */
 		file.SeekTo(old_pos, SEEK_SET);
 	}
 }
 
+/**
+ * Parse the sprite section of GRFs.
+ * @param file GRF we're currently processing.
+ */
+void ReadGRFSpriteOffsets(SpriteFile &file)
+{
+	ReadGRFSpriteOffsets(file, _grf_sprite_offsets);
+}
+
+/**
+ * Use a previously parsed sprite section for the GRF we're currently processing, instead of parsing it again.
+ * @param file GRF we're currently processing, positioned just after the container header.
+ * @param offsets Sprite section of the GRF, as parsed by ReadGRFSpriteOffsets(SpriteFile &, GrfSpriteOffsets &).
+ */
+void SetGRFSpriteOffsets(SpriteFile &file, GrfSpriteOffsets offsets)
+{
+	/* Skip sprite section offset if present. */
+	if (file.GetContainerVersion() >= 2) file.ReadDword();
+
+	_grf_sprite_offsets = std::move(offsets);
+}
+
 
 /**
  * Load a real or recolour sprite.
@@ -14,6 +14,7 @@
 #include "zoom_type.h"
 #include "spriteloader/spriteloader.hpp"
 #include "3rdparty/robin_hood/robin_hood.h"
+#include "3rdparty/cpp-btree/btree_map.h"
 
 /** Data structure describing a sprite. */
 struct Sprite {
@@ -83,7 +84,19 @@ void IncreaseSpriteLRU();
 SpriteFile &OpenCachedSpriteFile(const std::string &filename, Subdirectory subdir, bool palette_remap);
 std::span<const std::unique_ptr<SpriteFile>> GetCachedSpriteFiles();
 
+/** Position of a sprite in the sprite section of a GRF. */
+struct GrfSpriteOffset {
+	size_t file_pos;
+	uint count;
+	uint16_t control_flags;
+};
+
+/** Map from sprite numbers to position in the GRF file. */
+typedef btree::btree_map<uint32_t, GrfSpriteOffset> GrfSpriteOffsets;
+
 void ReadGRFSpriteOffsets(SpriteFile &file);
+void ReadGRFSpriteOffsets(SpriteFile &file, GrfSpriteOffsets &offsets);
+void SetGRFSpriteOffsets(SpriteFile &file, GrfSpriteOffsets offsets);
 size_t GetGRFSpriteOffset(uint32_t id);
 bool LoadNextSprite(int load_index, SpriteFile &file, uint file_sprite_id);
 bool SkipSpriteData(SpriteFile &file, uint8_t type, uint16_t num);
@@ -426,6 +426,7 @@ void Station::AddIndustryToDeliver(Industry *ind, TileIndex tile)
 		if (pos->distance > distance) {
 			this->industries_near.erase(pos);
 			this->industries_near.insert(IndustryListEntry{distance, ind});
+			this->InvalidateIndustryDeliveryCache();
 		}
 		return;
 	}
@@ -434,6 +435,7 @@ void Station::AddIndustryToDeliver(Industry *ind, TileIndex tile)
 	if (!ind->IsCargoAccepted()) return;
 
 	this->industries_near.insert(IndustryListEntry{distance, ind});
+	this->InvalidateIndustryDeliveryCache();
 }
 
 /**
@@ -445,9 +447,31 @@ void Station::RemoveIndustryToDeliver(Industry *ind)
 	auto pos = std::find_if(this->industries_near.begin(), this->industries_near.end(), [&](const IndustryListEntry &e) { return e.industry->index == ind->index; });
 	if (pos != this->industries_near.end()) {
 		this->industries_near.erase(pos);
+		this->InvalidateIndustryDeliveryCache();
 	}
 }
 
+/**
+ * Get the industries in industries_near which accept the given cargo, in the same order as industries_near.
+ * The list is built on first use and kept until industries_near changes, so that cargo delivery does not
+ * need to check the accepted cargoes of every nearby industry for every delivery.
+ * Industries which temporarily refuse the cargo are included, this must still be checked at delivery.
+ * @param cargo Cargo type.
+ * @return List of accepting industries.
+ */
+const IndustryDeliveryList &Station::GetIndustryDeliveryList(CargoID cargo) const
+{
+	auto iter = this->industry_delivery_cache.find(cargo);
+	if (iter != this->industry_delivery_cache.end()) return iter->second;
+
+	IndustryDeliveryList &list = this->industry_delivery_cache[cargo];
+	for (const IndustryListEntry &entry : this->industries_near) {
+		int cargo_index = entry.industry->GetCargoAcceptedIndex(cargo);
+		if (cargo_index >= 0) list.push_back({ entry.industry, static_cast<uint8_t>(cargo_index) });
+	}
+	return list;
+}
+
 
 /**
  * Remove this station from the nearby stations lists of nearby towns and industries.
@@ -494,6 +518,7 @@ bool Station::CatchmentCoversTown(TownID t) const
 void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 {
 	this->industries_near.clear();
+	this->InvalidateIndustryDeliveryCache();
 	if (!no_clear_nearby_lists) this->RemoveFromAllNearbyLists();
 
 	if (this->rect.IsEmpty()) {
@@ -872,6 +872,14 @@ struct IndustryCompare {
 
 typedef btree::btree_set<IndustryListEntry, IndustryCompare> IndustryList;
 
+/** Entry in a station's per-cargo list of accepting industries, @see Station::GetIndustryDeliveryList() */
+struct IndustryDeliveryEntry {
+	Industry *industry; ///< Industry which accepts the cargo
+	uint8_t cargo_index;  ///< Index of the cargo in the industry's accepted cargo list
+};
+
+typedef std::vector<IndustryDeliveryEntry> IndustryDeliveryList;
+
 /** Station data structure */
 struct Station final : SpecializedStation<Station, false> {
 public:
@@ -910,6 +918,7 @@ public:
 	CargoTypes always_accepted;       ///< Bitmask of always accepted cargo types (by houses, HQs, industry tiles when industry doesn't accept cargo)
 
 	IndustryList industries_near; ///< Cached list of industries near the station that can accept cargo, @see DeliverGoodsToIndustry()
+	mutable btree::btree_map<CargoID, IndustryDeliveryList> industry_delivery_cache; ///< NOSAVE: Per cargo subset of industries_near which accept that cargo, in the same order, built on demand
 	Industry *industry;           ///< NOSAVE: Associated industry for neutral stations. (Rebuilt on load from Industry->st)
 
 	CargoTypes station_cargo_history_cargoes = 0;                                            ///< Bitmask of cargoes in station_cargo_history
@@ -945,6 +954,13 @@ public:
 	bool CatchmentCoversTown(TownID t) const;
 	void AddIndustryToDeliver(Industry *ind, TileIndex tile);
 	void RemoveIndustryToDeliver(Industry *ind);
+	const IndustryDeliveryList &GetIndustryDeliveryList(CargoID cargo) const;
+
+	/** Invalidate the per cargo lists of accepting industries, this must be called whenever industries_near is changed. */
+	inline void InvalidateIndustryDeliveryCache()
+	{
+		this->industry_delivery_cache.clear();
+	}
 	void RemoveFromAllNearbyLists();
 
 	inline bool TileIsInCatchment(TileIndex tile) const
@@ -60,6 +60,8 @@
 #include "cheat_type.h"
 #include "newgrf_roadstop.h"
 #include "core/math_func.hpp"
+#include "network/network.h"
+#include "core/checksum_func.hpp"
 
 #include "widgets/station_widget.h"
 
@@ -4405,6 +4407,10 @@ static void UpdateStationRating(Station *st)
 					/* If the average number per next hop is low, be more forgiving. */
 					ge->max_waiting_cargo = waiting_avg;
 				}
+
+				DEBUG_UPDATESTATECHECKSUM("UpdateStationRating: st: %u, cargo: %u, rating: %u, waiting: %u", st->index, cs->Index(), ge->rating, ge->CargoAvailableCount());
+				UpdateStateChecksum(SCS_STATION, (((uint64_t) st->index) << 32) | (cs->Index() << 8) | ge->rating);
+				UpdateStateChecksum(SCS_STATION, ge->CargoAvailableCount());
 			}
 		}
 	}
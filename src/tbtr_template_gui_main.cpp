@@ -194,6 +194,8 @@ class TemplateReplaceWindow : public Window {
 private:
 
 	GUIGroupList groups;          ///< List of groups
+	mutable btree::btree_map<GroupID, uint> replacement_counts; ///< Cached number of trains needing template replacement per group
+	mutable bool replacement_counts_valid = false;               ///< Whether replacement_counts is up to date
 
 	int bottom_matrix_item_size = 0;
 
@@ -582,10 +584,17 @@ public:
 	{
 		this->groups.ForceRebuild();
 		this->templates.ForceRebuild();
+		this->replacement_counts_valid = false;
 		this->UpdateButtonState();
 		this->SetDirty();
 	}
 
+	void OnHundredthTick() override
+	{
+		this->replacement_counts_valid = false;
+		this->SetWidgetDirty(TRW_WIDGET_TOP_MATRIX);
+	}
+
 	void OnQueryTextFinished(char *str) override
 	{
 		if (str != nullptr && (this->selected_template_index >= 0) && (this->selected_template_index < (int)this->templates.size()) && !editInProgress) {
@@ -637,6 +646,11 @@ public:
 
 		bool rtl = _current_text_dir == TD_RTL;
 
+		if (!this->replacement_counts_valid) {
+			CountTrainsNeedingTemplateReplacementPerGroup(this->owner, this->replacement_counts);
+			this->replacement_counts_valid = true;
+		}
+
 		/* Then treat all groups defined by/for the current company */
 		for (int i = this->vscroll[0]->GetPosition(); i < max; ++i) {
 			const GUIGroupListItem &item = (this->groups)[i];
@@ -688,8 +702,8 @@ public:
 
 			/* Draw the number of trains that still need to be treated by the currently selected template replacement */
 			if (tid != INVALID_TEMPLATE) {
-				const TemplateVehicle *tv = TemplateVehicle::Get(tid);
-				const uint num_trains = CountTrainsNeedingTemplateReplacement(g_id, tv);
+				auto count_it = this->replacement_counts.find(g_id);
+				const uint num_trains = (count_it != this->replacement_counts.end()) ? count_it->second : 0;
 				SetDParam(0, num_trains > 0 ? TC_ORANGE : TC_GREY);
 				SetDParam(1, num_trains);
 				draw_text(col2 + ScaleGUITrad(4), right - ScaleGUITrad(4), STR_TMPL_NUM_TRAINS_NEED_RPL, num_trains > 0 ? TC_BLACK : TC_GREY, SA_RIGHT);
@@ -237,20 +237,21 @@ void TemplateDepotVehicles::Init(TileIndex tile)
 {
 	FindVehicleOnPos(tile, VEH_TRAIN, this, [](Vehicle *v, void *data) -> Vehicle * {
 		TemplateDepotVehicles *self = static_cast<TemplateDepotVehicles *>(data);
-		self->vehicles.insert(v->index);
+		self->vehicles.insert({ v->engine_type, v->index });
 		return v;
 	});
 }
 
 void TemplateDepotVehicles::RemoveVehicle(VehicleID id)
 {
-	this->vehicles.erase(id);
+	this->vehicles.erase({ Train::Get(id)->engine_type, id });
 }
 
 Train *TemplateDepotVehicles::ContainsEngine(EngineID eid, Train *not_in)
 {
-	for (VehicleID id : this->vehicles) {
-		Train *t = Train::GetIfValid(id);
+	/* Only the vehicles of the requested engine type need to be checked, in the same (vehicle ID) order as a full scan */
+	for (auto it = this->vehicles.lower_bound({ eid, 0 }); it != this->vehicles.end() && it->first == eid; ++it) {
+		Train *t = Train::GetIfValid(it->second);
 		if (t == nullptr) continue;
 		/* Conditions: v is stopped in the given depot, has the right engine and if 'not_in' is given v must not be contained within 'not_in'.
 		 * If 'not_in' is nullptr, no check is needed. */
@@ -323,6 +324,26 @@ uint CountTrainsNeedingTemplateReplacement(GroupID g_id, const TemplateVehicle *
 	return count;
 }
 
+/**
+ * Count the trains of each group of a company which need template replacement, using a single pass over all trains.
+ * This is equivalent to calling CountTrainsNeedingTemplateReplacement() for every group with its (recursive) template.
+ * @param owner Company to count the trains of.
+ * @param[out] counts Number of trains needing replacement, per group. Groups without any such trains are not included.
+ */
+void CountTrainsNeedingTemplateReplacementPerGroup(Owner owner, btree::btree_map<GroupID, uint> &counts)
+{
+	counts.clear();
+
+	for (const Train *t : Train::IterateFrontOnly()) {
+		if (t->owner != owner || !t->IsPrimaryVehicle()) continue;
+
+		const TemplateVehicle *tv = GetTemplateVehicleByGroupIDRecursive(t->group_id);
+		if (tv != nullptr && TrainTemplateDifference(t, tv) != TBTRDF_NONE) {
+			counts[t->group_id]++;
+		}
+	}
+}
+
 /* Refit each vehicle in t as is in tv, assume t and tv contain the same types of vehicles */
 CommandCost CmdRefitTrainFromTemplate(Train *t, const TemplateVehicle *tv, DoCommandFlag flags)
 {
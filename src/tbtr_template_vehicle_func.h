@@ -13,6 +13,7 @@
 #include "stdafx.h"
 #include "window_gui.h"
 #include "tbtr_template_vehicle.h"
+#include "3rdparty/cpp-btree/btree_map.h"
 #include "3rdparty/cpp-btree/btree_set.h"
 
 Train *VirtualTrainFromTemplateVehicle(const TemplateVehicle *tv, StringID &err, uint32_t user);
@@ -34,8 +35,9 @@ TemplateVehicle *GetTemplateVehicleByGroupID(GroupID gid);
 TemplateVehicle *GetTemplateVehicleByGroupIDRecursive(GroupID gid);
 Train *ChainContainsEngine(EngineID eid, Train *chain);
 
+/** Trains in a depot which may be reused for template replacement, indexed by engine type. */
 struct TemplateDepotVehicles {
-	btree::btree_set<VehicleID> vehicles;
+	btree::btree_set<std::pair<EngineID, VehicleID>> vehicles;
 
 	void Init(TileIndex tile);
 	void RemoveVehicle(VehicleID id);
@@ -43,6 +45,7 @@ struct TemplateDepotVehicles {
 };
 
 uint CountTrainsNeedingTemplateReplacement(GroupID g_id, const TemplateVehicle *tv);
+void CountTrainsNeedingTemplateReplacementPerGroup(Owner owner, btree::btree_map<GroupID, uint> &counts);
 
 CommandCost TestBuyAllTemplateVehiclesInChain(const TemplateVehicle *tv, TileIndex tile);
 
@@ -498,11 +498,13 @@ static void CommonRaiseLowerBigLand(TileIndex tile, int mode)
 			}
 		}
 
+		std::vector<CommandBatchItem> batch;
 		for (TileIndex tile2 : ta) {
 			if (TileHeight(tile2) == h) {
-				DoCommandP(tile2, SLOPE_N, (uint32_t)mode, CMD_TERRAFORM_LAND);
+				batch.push_back({ tile2, SLOPE_N, (uint32_t)mode, CMD_TERRAFORM_LAND, 0 });
 			}
 		}
+		DoCommandPBatch(batch);
 	}
 }
 
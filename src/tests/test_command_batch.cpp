@@ -0,0 +1,81 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file test_command_batch.cpp Tests for executing commands via CMD_BATCH_COMMANDS. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../clear_map.h"
+#include "../command_func.h"
+#include "../company_func.h"
+#include "../core/backup_type.hpp"
+#include "../map_func.h"
+#include "../openttd.h"
+#include "../settings_type.h"
+#include "../slope_type.h"
+#include "../void_map.h"
+
+#include "../safeguards.h"
+
+/** Set up a small flat map of clear tiles, with void tiles along the edges as with freeform edges. */
+static void SetupFlatMap()
+{
+	AllocateMap(64, 64);
+	for (TileIndex t = 0; t < MapSize(); t++) {
+		if (TileX(t) == 0 || TileY(t) == 0 || TileX(t) == MapMaxX() || TileY(t) == MapMaxY()) {
+			MakeVoid(t);
+		} else {
+			MakeClear(t, CLEAR_GRASS, 3);
+			SetTileHeight(t, 0);
+		}
+	}
+}
+
+TEST_CASE("CommandBatch - raising the land of multiple tiles as a single batch")
+{
+	SetupFlatMap();
+
+	Backup<GameMode> game_mode(_game_mode, GM_EDITOR, FILE_LINE);
+	Backup<CompanyID> cur_company(_current_company, OWNER_NONE, FILE_LINE);
+	Backup<uint8_t> map_height_limit(_settings_game.construction.map_height_limit, 30, FILE_LINE);
+	Backup<bool> freeform_edges(_settings_game.construction.freeform_edges, true, FILE_LINE);
+	Backup<uint8_t> map_edge_mode(_settings_game.construction.map_edge_mode, 0, FILE_LINE);
+
+	/* CMD_TERRAFORM_LAND is a CMD_ALL_TILES command, batched in the same way as by the raise/lower big land tool */
+	std::vector<CommandBatchItem> batch;
+	for (uint x = 10; x < 14; x++) {
+		for (uint y = 20; y < 23; y++) {
+			batch.push_back({ TileXY(x, y), SLOPE_N, 1, CMD_TERRAFORM_LAND, 0 });
+		}
+	}
+	/* A void tile is allowed for CMD_ALL_TILES commands, this raises the northern corner of tile 1 x 31 */
+	batch.push_back({ TileXY(0, 30), SLOPE_S, 1, CMD_TERRAFORM_LAND, 0 });
+
+	CHECK(DoCommandPBatch(batch));
+
+	for (uint x = 10; x < 14; x++) {
+		for (uint y = 20; y < 23; y++) {
+			CHECK(TileHeight(TileXY(x, y)) == 1);
+		}
+	}
+	CHECK(TileHeight(TileXY(1, 31)) == 1);
+	CHECK(TileHeight(TileXY(9, 20)) == 0);
+	CHECK(TileHeight(TileXY(10, 23)) == 0);
+
+	/* Batching an out of range tile fails the whole batch */
+	batch.push_back({ MapSize(), SLOPE_N, 1, CMD_TERRAFORM_LAND, 0 });
+	CHECK_FALSE(DoCommandPBatch(batch));
+	CHECK(TileHeight(TileXY(10, 20)) == 1);
+
+	map_edge_mode.Restore();
+	freeform_edges.Restore();
+	map_height_limit.Restore();
+	cur_company.Restore();
+	game_mode.Restore();
+}
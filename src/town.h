@@ -19,6 +19,7 @@
 #include "table/strings.h"
 #include "company_func.h"
 #include "core/tinystring_type.hpp"
+#include "3rdparty/cpp-btree/btree_set.h"
 #include <array>
 #include <list>
 #include <memory>
@@ -127,6 +128,8 @@ struct Town : TownPool::PoolItem<&_town_pool> {
 
 	uint16_t grow_counter;           ///< counter to count when to grow, value is smaller than or equal to growth_rate
 	uint16_t growth_rate;            ///< town growth rate
+	std::vector<TileIndex> growth_frontier; ///< road tiles at the edge of the town which growth attempts start from, when economy.town_growth_frontier is enabled
+	btree::btree_set<TileIndex> growth_frontier_tiles; ///< the tiles in growth_frontier, for checking whether a tile is already present
 
 	uint8_t fund_buildings_months;   ///< fund buildings program in action?
 	uint8_t road_build_months;       ///< fund road reconstruction in action?
@@ -272,6 +275,7 @@ void ClearTownHouse(Town *t, TileIndex tile);
 void UpdateTownMaxPass(Town *t);
 void UpdateTownRadius(Town *t);
 void UpdateTownRadii();
+void ClearAllTownGrowthFrontiers();
 CommandCost CheckIfAuthorityAllowsNewStation(TileIndex tile, DoCommandFlag flags);
 Town *ClosestTownFromTile(TileIndex tile, uint threshold);
 void ChangeTownRating(Town *t, int add, int max, DoCommandFlag flags);
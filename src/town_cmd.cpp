@@ -1900,9 +1900,10 @@ static bool CanFollowRoad(const Town *t, TileIndex tile, DiagDirection dir)
  * Try to grow a town at a given road tile.
  * @param t The town to grow.
  * @param tile The road tile to try growing from.
+ * @param grown_tile If not nullptr, set to the road tile the town grew from on success.
  * @return true if we successfully expanded the town.
  */
-static bool GrowTownAtRoad(Town *t, TileIndex tile)
+static bool GrowTownAtRoad(Town *t, TileIndex tile, TileIndex *grown_tile = nullptr)
 {
 	/* Special case.
 	 * @see GrowTownInTile Check the else if
@@ -1936,7 +1937,10 @@ static bool GrowTownAtRoad(Town *t, TileIndex tile)
 
 		/* Try to grow the town from this point */
 		GrowTownInTile(&tile, cur_rb, target_dir, t);
-		if (_grow_town_result == GROWTH_SUCCEED) return true;
+		if (_grow_town_result == GROWTH_SUCCEED) {
+			if (grown_tile != nullptr) *grown_tile = tile;
+			return true;
+		}
 
 		if (orig_tile == tile) {
 			/* Exclude the source position from the bitmask
@@ -1989,6 +1993,121 @@ static bool GrowTownAtRoad(Town *t, TileIndex tile)
 	return false;
 }
 
+/**
+ * Check whether a tile belongs in the growth frontier of a town.
+ * That is a town road tile of the town, which has at least one neighbour which the town may still build a road piece or house on.
+ * Neighbours which the town can never build on, such as water, rail and industries, do not count.
+ * @param t The town.
+ * @param tile The tile to check.
+ * @return true if the tile is a frontier tile.
+ */
+static bool IsTownGrowthFrontierTile(const Town *t, TileIndex tile)
+{
+	if (!IsTileType(tile, MP_ROAD) || IsRoadDepot(tile) || GetTownIndex(tile) != t->index) return false;
+	if (GetTownRoadBits(tile) == ROAD_NONE) return false;
+
+	for (DiagDirection dir = DIAGDIR_BEGIN; dir < DIAGDIR_END; dir++) {
+		TileIndex neighbour = TileAddByDiagDir(tile, dir);
+		switch (GetTileType(neighbour)) {
+			case MP_ROAD:
+			case MP_HOUSE:
+			case MP_VOID:
+			case MP_WATER:
+			case MP_RAILWAY:
+			case MP_INDUSTRY:
+			case MP_STATION:
+			case MP_OBJECT:
+			case MP_TUNNELBRIDGE:
+				break;
+
+			default:
+				return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Add a tile to the growth frontier of a town, if it is a frontier tile and not already present.
+ * @param t The town.
+ * @param tile The tile to add.
+ */
+static void AddTownGrowthFrontierTile(Town *t, TileIndex tile)
+{
+	if (!IsValidTile(tile) || !IsTownGrowthFrontierTile(t, tile)) return;
+	if (!t->growth_frontier_tiles.insert(tile).second) return;
+	t->growth_frontier.push_back(tile);
+}
+
+/**
+ * Rebuild the growth frontier of a town by scanning the area around the town centre.
+ * @param t The town.
+ */
+static void RebuildTownGrowthFrontier(Town *t)
+{
+	t->growth_frontier.clear();
+	t->growth_frontier_tiles.clear();
+
+	TileArea area(t->xy, 1, 1);
+	area.Expand(IntSqrt(t->cache.squared_town_zone_radius[HZB_TOWN_EDGE]) + 4);
+	for (TileIndex tile : area) {
+		if (IsTownGrowthFrontierTile(t, tile)) {
+			t->growth_frontier.push_back(tile);
+			t->growth_frontier_tiles.insert(tile);
+		}
+	}
+}
+
+/** Clear the growth frontiers of all towns, these are rebuilt when next needed. */
+void ClearAllTownGrowthFrontiers()
+{
+	for (Town *t : Town::Iterate()) {
+		t->growth_frontier.clear();
+		t->growth_frontier_tiles.clear();
+	}
+}
+
+/**
+ * Try to grow a town from a road tile randomly chosen from its growth frontier.
+ * Interior road tiles which can no longer grow are not part of the frontier,
+ * so growth attempts in large towns are not wasted walking from the centre to the edge.
+ * As growing from a road tile involves random choices, a frontier tile from which growth fails is kept,
+ * frontier tiles are only removed once they are no longer frontier tiles. The frontier is rebuilt when it becomes empty.
+ * @param t The town to grow.
+ * @return true if we successfully expanded the town.
+ */
+static bool GrowTownFromFrontier(Town *t)
+{
+	std::vector<TileIndex> &frontier = t->growth_frontier;
+	if (frontier.empty()) RebuildTownGrowthFrontier(t);
+
+	while (!frontier.empty()) {
+		const size_t idx = RandomRange((uint32_t)frontier.size());
+		const TileIndex tile = frontier[idx];
+		if (!IsTownGrowthFrontierTile(t, tile)) {
+			/* The tile changed since it was added */
+			t->growth_frontier_tiles.erase(tile);
+			frontier[idx] = frontier.back();
+			frontier.pop_back();
+			continue;
+		}
+
+		TileIndex grown_tile = INVALID_TILE;
+		if (GrowTownAtRoad(t, tile, &grown_tile)) {
+			/* Pick up any road pieces built next to where the town grew */
+			AddTownGrowthFrontierTile(t, grown_tile);
+			for (DiagDirection dir = DIAGDIR_BEGIN; dir < DIAGDIR_END; dir++) {
+				AddTownGrowthFrontierTile(t, TileAddByDiagDir(grown_tile, dir));
+			}
+			return true;
+		}
+
+		return false;
+	}
+
+	return false;
+}
+
 /**
  * Generate a random road block.
  * The probability of a straight road
@@ -2031,6 +2150,15 @@ static bool GrowTown(Town *t)
 	/* Current "company" is a town */
 	Backup<CompanyID> cur_company(_current_company, OWNER_TOWN, FILE_LINE);
 
+	if (_settings_game.economy.town_growth_frontier) {
+		bool success = GrowTownFromFrontier(t);
+		if (success || !t->growth_frontier.empty()) {
+			cur_company.Restore();
+			return success;
+		}
+		/* No frontier tiles could be found, fall back to searching from the town centre */
+	}
+
 	TileIndex tile = t->xy; // The tile we are working with ATM
 
 	/* Find a road that we can base the construction on. */
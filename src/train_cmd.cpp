@@ -4544,7 +4544,7 @@ static ChooseTrainTrackResult ChooseTrainTrack(Train *v, TileIndex tile, DiagDir
 
 		Track next_track = DoTrainPathfind(v, new_tile, dest_enterdir, tracks, path_found, do_track_reservation, &res_dest, &final_dest);
 		DEBUG_UPDATESTATECHECKSUM("ChooseTrainTrack: v: %u, path_found: %d, next_track: %d", v->index, path_found, next_track);
-		UpdateStateChecksum((((uint64_t) v->index) << 32) | (path_found << 16) | next_track);
+		UpdateStateChecksum(SCS_VEHICLE, (((uint64_t) v->index) << 32) | (path_found << 16) | next_track);
 		if (new_tile == tile) best_track = next_track;
 		v->HandlePathfindingResult(path_found);
 	}
@@ -5613,6 +5613,21 @@ bool TrainController(Train *v, Vehicle *nomove, bool reverse)
 
 
 		GetNewVehiclePosResult gp = GetNewVehiclePos(v);
+		if (prev != nullptr && v->Next() != nullptr && gp.old_tile == gp.new_tile && !update_signal_tunbridge_exit &&
+				!(v->track & (TRACK_BIT_WORMHOLE | TRACK_BIT_DEPOT)) && IsPlainRailTile(gp.new_tile)) {
+			/* Fast path for a vehicle in the middle of the train which stays within a plain rail tile.
+			 * Entering the tile has no effect, the direction cannot change, and signals and crossings
+			 * are only updated by the first and last vehicles, so only the position needs to be updated. */
+			v->UpdateDeltaXY();
+			v->x_pos = gp.x;
+			v->y_pos = gp.y;
+			DecreaseReverseDistance(v);
+			if (v->lookahead != nullptr) AdvanceLookAheadPosition(v);
+			if (HasBit(v->flags, VRF_PENDING_SPEED_RESTRICTION)) DecrementPendingSpeedRestrictions(v);
+			v->UpdateInclination(false, false);
+			continue;
+		}
+
 		if (!(v->track & TRACK_BIT_WORMHOLE) && gp.old_tile != gp.new_tile &&
 				IsRailBridgeHeadTile(gp.old_tile) && DiagdirBetweenTiles(gp.old_tile, gp.new_tile) == GetTunnelBridgeDirection(gp.old_tile)) {
 			/* left a bridge headtile into a wormhole */
@@ -6870,7 +6885,7 @@ Money Train::GetRunningCost() const
 bool Train::Tick()
 {
 	DEBUG_UPDATESTATECHECKSUM("Train::Tick: v: %u, x: %d, y: %d, track: %d", this->index, this->x_pos, this->y_pos, this->track);
-	UpdateStateChecksum((((uint64_t) this->x_pos) << 32) | (this->y_pos << 16) | this->track);
+	UpdateStateChecksum(SCS_VEHICLE, (((uint64_t) this->x_pos) << 32) | (this->y_pos << 16) | this->track);
 	if (this->IsFrontEngine()) {
 		if (!((this->vehstatus & VS_STOPPED) || this->IsWaitingInDepot()) || this->cur_speed > 0) this->running_ticks++;
 
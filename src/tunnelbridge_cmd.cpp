@@ -1935,6 +1935,7 @@ void MarkSingleBridgeSignalDirty(TileIndex tile, TileIndex bridge_start_tile)
 	uint position, x, y;
 	GetBridgeSignalXY(tile, GetTunnelBridgeDirection(bridge_start_tile), opposite_side, position, x, y);
 	Point pt = RemapCoords(x, y, GetBridgePixelHeight(bridge_start_tile) + 5 - BRIDGE_Z_START);
+	MarkTileDrawCacheDirty(tile);
 	MarkAllViewportsDirty(
 			pt.x - SIGNAL_DIRTY_LEFT,
 			pt.y - SIGNAL_DIRTY_TOP,
@@ -2026,6 +2027,7 @@ void MarkTunnelBridgeSignalDirty(TileIndex tile, bool exit)
 	int z = GetTunnelBridgeSignalZNonRailCustom(tile, side, exit, dir);
 
 	Point pt = RemapCoords(x, y, z);
+	MarkTileDrawCacheDirty(tile);
 	MarkAllViewportsDirty(
 			pt.x - SIGNAL_DIRTY_LEFT,
 			pt.y - SIGNAL_DIRTY_TOP,
@@ -552,6 +552,25 @@ Vehicle *VehicleFromPosXY(int x, int y, VehicleType type, void *data, VehicleFro
 	return VehicleFromTileHash(xl, yl, xu, yu, type, data, proc, find_first);
 }
 
+/**
+ * Helper function for FindVehicleOnPosXYRect.
+ * @note Do not call this function directly!
+ * @param xl   The lower X location on the map (inclusive)
+ * @param yl   The lower Y location on the map (inclusive)
+ * @param xu   The upper X location on the map (inclusive)
+ * @param yu   The upper Y location on the map (inclusive)
+ * @param type The vehicle type
+ * @param data Arbitrary data passed to proc
+ * @param proc The proc that determines whether a vehicle will be "found".
+ * @param find_first Whether to return on the first found or iterate over
+ *                   all vehicles
+ * @return the best matching or first vehicle (depending on find_first).
+ */
+Vehicle *VehicleFromPosXYRect(int xl, int yl, int xu, int yu, VehicleType type, void *data, VehicleFromPosProc *proc, bool find_first)
+{
+	return VehicleFromTileHash(xl / (int)TILE_SIZE, yl / (int)TILE_SIZE, xu / (int)TILE_SIZE, yu / (int)TILE_SIZE, type, data, proc, find_first);
+}
+
 /**
  * Helper function for FindVehicleOnPos/HasVehicleOnPos.
  * @note Do not call this function directly!
@@ -1781,6 +1800,7 @@ void CallVehicleTicks()
 
 	/* do Template Replacement */
 	Backup<CompanyID> tmpl_cur_company(_current_company, FILE_LINE);
+	uint template_replacements_remaining = _settings_game.vehicle.max_template_replacements_per_tick;
 	for (VehicleID index : _vehicles_to_templatereplace) {
 		Train *t = Train::Get(index);
 
@@ -1791,6 +1811,18 @@ void CallVehicleTicks()
 		if (it->second) t->vehstatus &= ~VS_STOPPED;
 		_vehicles_to_autoreplace.erase(it);
 
+		if (_settings_game.vehicle.max_template_replacements_per_tick != 0) {
+			const TemplateVehicle *tv = GetTemplateVehicleByGroupIDRecursive(t->group_id);
+			if (tv != nullptr && ShouldServiceTrainForTemplateReplacement(t, tv)) {
+				if (template_replacements_remaining == 0) {
+					/* Over the limit for this tick, the train leaves unchanged and is replaced at a later depot visit */
+					SetBit(t->vehicle_flags, VF_REPLACEMENT_PENDING);
+					continue;
+				}
+				template_replacements_remaining--;
+			}
+		}
+
 		/* Store the position of the effect as the vehicle pointer will become invalid later */
 		int x = t->x_pos;
 		int y = t->y_pos;
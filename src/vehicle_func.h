@@ -123,6 +123,24 @@ inline bool HasVehicleOnPosXY(int x, int y, VehicleType type, void *data, Vehicl
 	return VehicleFromPosXY(x, y, type, data, proc, true) != nullptr;
 }
 
+/**
+ * Find a vehicle from the tiles covering a rectangle of map coordinates.
+ * Unlike #FindVehicleOnPosXY no extra margin is added around the given area.
+ * The same requirements on the ordering of results as for #FindVehicleOnPosXY apply.
+ * @param xl   The lower X location on the map (inclusive)
+ * @param yl   The lower Y location on the map (inclusive)
+ * @param xu   The upper X location on the map (inclusive)
+ * @param yu   The upper Y location on the map (inclusive)
+ * @param type The vehicle type
+ * @param data Arbitrary data passed to proc
+ * @param proc The proc that determines whether a vehicle will be "found".
+ */
+inline void FindVehicleOnPosXYRect(int xl, int yl, int xu, int yu, VehicleType type, void *data, VehicleFromPosProc *proc)
+{
+	extern Vehicle *VehicleFromPosXYRect(int xl, int yl, int xu, int yu, VehicleType type, void *data, VehicleFromPosProc *proc, bool find_first);
+	VehicleFromPosXYRect(xl, yl, xu, yu, type, data, proc, false);
+}
+
 void CallVehicleTicks();
 uint8_t CalcPercentVehicleFilled(const Vehicle *v, StringID *colour);
 uint8_t CalcPercentVehicleFilledOfCargo(const Vehicle *v, CargoID cargo);
@@ -13,6 +13,7 @@
 #include "vehiclelist.h"
 #include "vehiclelist_func.h"
 #include "group.h"
+#include "company_base.h"
 #include "tracerestrict.h"
 
 #include "safeguards.h"
@@ -158,16 +159,27 @@ bool GenerateVehicleSortList(VehicleList *list, const VehicleListIdentifier &vli
 		if (cid == CargoFilterCriteria::CF_ANY || VehicleCargoFilter(v, cid)) list->push_back(v);
 	};
 
-	auto fill_all_vehicles = [&]() {
-		for (const Vehicle *v : Vehicle::IterateTypeFrontOnly(vli.vtype)) {
-			if (!HasBit(v->subtype, GVSF_VIRTUAL) && v->owner == vli.company && v->IsPrimaryVehicle()) {
-				add_veh(v);
-			}
+	auto add_group = [&](const GroupStatistics &stats) {
+		for (VehicleID id : stats.vehicles) {
+			add_veh(Vehicle::Get(id));
 		}
 	};
 
+	auto fill_all_vehicles = [&]() {
+		if (Company::IsValidID(vli.company)) add_group(GroupStatistics::Get(vli.company, ALL_GROUP, vli.vtype));
+	};
+
 	switch (vli.type) {
 		case VL_STATION_LIST:
+			if (_order_destination_refcount_map_valid) {
+				/* Skip scanning all order lists when no vehicle of this type has an order to the station. */
+				bool found = false;
+				IterateOrderRefcountMapForDestinationID(vli.index, [&](CompanyID, OrderType, VehicleType veh_type, uint32_t) {
+					if (veh_type == vli.vtype) found = true;
+					return !found;
+				});
+				if (!found) break;
+			}
 			FindVehiclesWithOrder(
 				[&vli](const Vehicle *v) { return v->type == vli.vtype; },
 				[&vli](const Order *order) { return (order->IsType(OT_GOTO_STATION) || order->IsType(OT_GOTO_WAYPOINT) || order->IsType(OT_IMPLICIT)) && order->GetDestination() == vli.index; },
@@ -188,10 +200,14 @@ bool GenerateVehicleSortList(VehicleList *list, const VehicleListIdentifier &vli
 
 		case VL_GROUP_LIST:
 			if (vli.index != ALL_GROUP) {
-				for (const Vehicle *v : Vehicle::IterateTypeFrontOnly(vli.vtype)) {
-					if (!HasBit(v->subtype, GVSF_VIRTUAL) && v->IsPrimaryVehicle() &&
-							v->owner == vli.company && GroupIsInGroup(v->group_id, vli.index)) {
-						add_veh(v);
+				if (!Company::IsValidID(vli.company)) break;
+				if (IsDefaultGroupID(vli.index)) {
+					add_group(GroupStatistics::Get(vli.company, vli.index, vli.vtype));
+					break;
+				}
+				for (const Group *g : Group::Iterate()) {
+					if (g->owner == vli.company && g->vehicle_type == vli.vtype && GroupIsInGroup(g->index, vli.index)) {
+						add_group(g->statistics);
 					}
 				}
 				break;
@@ -356,6 +356,88 @@ static void ViewportDrawPlans(const Viewport *vp, Blitter *blitter, DrawPixelInf
 static std::unique_ptr<ViewportDrawerDynamic> _vdd;
 std::vector<std::unique_ptr<ViewportDrawerDynamic>> _spare_viewport_drawers;
 
+static constexpr uint TILE_DRAW_CACHE_CHUNK_SHIFT = 3;
+static constexpr uint TILE_DRAW_CACHE_CHUNK_SIZE = 1 << TILE_DRAW_CACHE_CHUNK_SHIFT;
+static constexpr size_t TILE_DRAW_CACHE_MAX_SPRITES = 1 << 20;
+
+/** Foundation and child sprite state of #_vd after drawing a tile, as needed to draw the tile selection on top of it. */
+struct TileDrawFoundationState {
+	ChildStoreID last_child;
+	int foundation[FOUNDATION_PART_END];
+	ChildStoreID last_foundation_child[FOUNDATION_PART_END];
+	Point foundation_offset[FOUNDATION_PART_END];
+	FoundationPart foundation_part;
+
+	void Save()
+	{
+		this->last_child = _vd.last_child;
+		this->foundation_part = _vd.foundation_part;
+		for (uint part = 0; part < FOUNDATION_PART_END; part++) {
+			this->foundation[part] = _vd.foundation[part];
+			this->last_foundation_child[part] = _vd.last_foundation_child[part];
+			this->foundation_offset[part] = _vd.foundation_offset[part];
+		}
+	}
+
+	void Restore() const
+	{
+		_vd.last_child = this->last_child;
+		_vd.foundation_part = this->foundation_part;
+		for (uint part = 0; part < FOUNDATION_PART_END; part++) {
+			_vd.foundation[part] = this->foundation[part];
+			_vd.last_foundation_child[part] = this->last_foundation_child[part];
+			_vd.foundation_offset[part] = this->foundation_offset[part];
+		}
+	}
+
+	/**
+	 * Translate all sprite indices.
+	 * @param translate Function translating a #ChildStoreID.
+	 */
+	template <typename F>
+	void Translate(F translate)
+	{
+		this->last_child = translate(this->last_child);
+		for (uint part = 0; part < FOUNDATION_PART_END; part++) {
+			this->foundation[part] = this->foundation[part] >= 0 ? (int)translate(static_cast<ChildStoreID>(this->foundation[part])) : -1;
+			if (this->foundation[part] == (int)NO_CHILD_STORE) this->foundation[part] = -1;
+			this->last_foundation_child[part] = translate(this->last_foundation_child[part]);
+		}
+	}
+};
+
+/** Output of the draw_tile_proc of a single tile in a TileDrawCacheChunk, all indices are relative to the chunk. */
+struct TileDrawCacheTile {
+	uint32_t tile_sprites_end;
+	uint32_t parent_sprites_end;
+	uint32_t child_sprites_end;
+	TileDrawFoundationState state;
+};
+
+/** Landscape sprites of a square chunk of map tiles at one zoom level, which are replayed instead of calling draw_tile_proc each frame. */
+struct TileDrawCacheChunk {
+	TileSpriteToDrawVector tile_sprites;
+	ParentSpriteToDrawVector parent_sprites;
+	ParentSpriteToDrawSubSpriteHolder parent_sprite_subsprites;
+	ChildScreenSpriteToDrawVector child_sprites;
+	std::array<TileDrawCacheTile, TILE_DRAW_CACHE_CHUNK_SIZE * TILE_DRAW_CACHE_CHUNK_SIZE> tiles;
+
+	size_t SpriteCount() const
+	{
+		return this->tile_sprites.size() + this->parent_sprites.size() + this->child_sprites.size();
+	}
+};
+
+/** Cache of landscape sprites, invalidated by marking tiles dirty. */
+struct TileDrawCache {
+	robin_hood::unordered_node_map<uint32_t, TileDrawCacheChunk> chunks[ZOOM_LVL_SPR_COUNT];
+	std::vector<uint8_t> chunk_zoom_masks; ///< Bit set of zoom levels for which each chunk is cached.
+	uint chunk_shift_x = 0;                ///< Log2 of the number of chunks in the X direction.
+	size_t chunk_count = 0;                ///< Total number of cached chunks, over all zoom levels.
+	size_t sprite_count = 0;               ///< Total number of cached sprites.
+};
+static TileDrawCache _tile_draw_cache;
+
 struct ViewportDrawerReturn {
 	Viewport *vp;
 	std::unique_ptr<ViewportDrawerDynamic> vdd;
@@ -468,6 +550,7 @@ enum ViewportDebugFlags {
 	VDF_SHOW_NO_LANDSCAPE_MAP_DRAW,
 	VDF_DISABLE_LANDSCAPE_CACHE,
 	VDF_DISABLE_THREAD,
+	VDF_DISABLE_TILE_DRAW_CACHE,
 };
 uint32_t _viewport_debug_flags;
 
@@ -1824,6 +1907,312 @@ static int GetViewportY(Point tile)
 	return (tile.y * (int)(TILE_PIXELS / 2) + tile.x * (int)(TILE_PIXELS / 2) - TilePixelHeightOutsideMap(tile.x, tile.y)) << ZOOM_BASE_SHIFT;
 }
 
+/**
+ * Set up #_cur_ti for a tile inside the map.
+ * @param tile The tile.
+ * @return The tile type.
+ */
+static TileType SetupCurrentTileInfo(TileIndex tile)
+{
+	_cur_ti.tile = tile;
+	_cur_ti.x = TileX(tile) * TILE_SIZE;
+	_cur_ti.y = TileY(tile) * TILE_SIZE;
+	std::tie(_cur_ti.tileh, _cur_ti.z) = GetTilePixelSlope(tile);
+	return GetTileType(tile);
+}
+
+/**
+ * Run the draw_tile_proc of every tile in a chunk and store the output.
+ * The drawing area is temporarily made unbounded, such that no sprites are culled.
+ * @param chunk Chunk to fill.
+ * @param chunk_x X coordinate of the chunk.
+ * @param chunk_y Y coordinate of the chunk.
+ */
+static void RecordTileDrawCacheChunk(TileDrawCacheChunk &chunk, uint chunk_x, uint chunk_y)
+{
+	const TileInfo ti_backup = _cur_ti;
+	const DrawPixelInfo dpi_backup = _vdd->dpi;
+	_vdd->dpi.left = -(1 << 29);
+	_vdd->dpi.top = -(1 << 29);
+	_vdd->dpi.width = 1 << 30;
+	_vdd->dpi.height = 1 << 30;
+
+	std::swap(chunk.tile_sprites, _vdd->tile_sprites_to_draw);
+	std::swap(chunk.parent_sprites, _vdd->parent_sprites_to_draw);
+	std::swap(chunk.parent_sprite_subsprites, _vdd->parent_sprite_subsprites);
+	std::swap(chunk.child_sprites, _vdd->child_screen_sprites_to_draw);
+
+	for (uint i = 0; i < chunk.tiles.size(); i++) {
+		TileDrawCacheTile &cached = chunk.tiles[i];
+
+		_vd.foundation_part = FOUNDATION_PART_NONE;
+		_vd.foundation[0] = -1;
+		_vd.foundation[1] = -1;
+		_vd.last_foundation_child[0] = NO_CHILD_STORE;
+		_vd.last_foundation_child[1] = NO_CHILD_STORE;
+		_vd.last_child = NO_CHILD_STORE;
+
+		const uint x = (chunk_x << TILE_DRAW_CACHE_CHUNK_SHIFT) + (i % TILE_DRAW_CACHE_CHUNK_SIZE);
+		const uint y = (chunk_y << TILE_DRAW_CACHE_CHUNK_SHIFT) + (i / TILE_DRAW_CACHE_CHUNK_SIZE);
+		if (x < MapSizeX() && y < MapSizeY()) {
+			TileType tile_type = SetupCurrentTileInfo(TileXY(x, y));
+			if (tile_type != MP_VOID) _tile_type_procs[tile_type]->draw_tile_proc(&_cur_ti, { 0, false });
+		}
+
+		cached.tile_sprites_end = (uint32_t)_vdd->tile_sprites_to_draw.size();
+		cached.parent_sprites_end = (uint32_t)_vdd->parent_sprites_to_draw.size();
+		cached.child_sprites_end = (uint32_t)_vdd->child_screen_sprites_to_draw.size();
+		cached.state.Save();
+	}
+
+	std::swap(chunk.tile_sprites, _vdd->tile_sprites_to_draw);
+	std::swap(chunk.parent_sprites, _vdd->parent_sprites_to_draw);
+	std::swap(chunk.parent_sprite_subsprites, _vdd->parent_sprite_subsprites);
+	std::swap(chunk.child_sprites, _vdd->child_screen_sprites_to_draw);
+
+	_vdd->dpi = dpi_backup;
+	_cur_ti = ti_backup;
+}
+
+/**
+ * Make sure the landscape sprite cache matches the map size and is not too large, before collecting the sprites of a drawing area.
+ * Chunks are not removed from the cache until the next call, except by marking tiles dirty.
+ */
+static void PrepareTileDrawCache()
+{
+	TileDrawCache &cache = _tile_draw_cache;
+	const uint chunk_shift_x = MapLogX() - TILE_DRAW_CACHE_CHUNK_SHIFT;
+	const size_t chunk_count = MapSize() >> (2 * TILE_DRAW_CACHE_CHUNK_SHIFT);
+	if (cache.chunk_zoom_masks.size() != chunk_count || cache.chunk_shift_x != chunk_shift_x || cache.sprite_count > TILE_DRAW_CACHE_MAX_SPRITES) {
+		ClearTileDrawCache();
+		cache.chunk_zoom_masks.assign(chunk_count, 0);
+		cache.chunk_shift_x = chunk_shift_x;
+	}
+}
+
+/**
+ * Get the cached chunk containing a tile at the current zoom level, recording it if necessary.
+ * @param x X coordinate of the tile.
+ * @param y Y coordinate of the tile.
+ * @return The chunk.
+ * @pre PrepareTileDrawCache() has been called.
+ */
+static const TileDrawCacheChunk &GetTileDrawCacheChunk(uint x, uint y)
+{
+	TileDrawCache &cache = _tile_draw_cache;
+	const uint chunk_x = x >> TILE_DRAW_CACHE_CHUNK_SHIFT;
+	const uint chunk_y = y >> TILE_DRAW_CACHE_CHUNK_SHIFT;
+	const uint32_t chunk_index = (chunk_y << cache.chunk_shift_x) | chunk_x;
+	const ZoomLevel zoom = _vdd->dpi.zoom;
+
+	auto result = cache.chunks[zoom].try_emplace(chunk_index);
+	TileDrawCacheChunk &chunk = result.first->second;
+	if (result.second) {
+		RecordTileDrawCacheChunk(chunk, chunk_x, chunk_y);
+		SetBit(cache.chunk_zoom_masks[chunk_index], zoom);
+		cache.chunk_count++;
+		cache.sprite_count += chunk.SpriteCount();
+	}
+	return chunk;
+}
+
+/**
+ * Append the cached sprites of a tile to a viewport drawer.
+ * Tile sprites and child sprites are not culled, parent sprites without children are culled against the drawing area as usual.
+ * This does not use any global state, so it may be called from worker threads for different drawers.
+ * @param vdd Viewport drawer to append to.
+ * @param chunk Chunk containing the tile.
+ * @param x X coordinate of the tile.
+ * @param y Y coordinate of the tile.
+ * @param parent_map Scratch buffer.
+ * @return The foundation state of the tile, with indices into the sprites of \a vdd.
+ */
+static TileDrawFoundationState AddCachedTileSpritesToDraw(ViewportDrawerDynamic *vdd, const TileDrawCacheChunk &chunk, uint x, uint y, std::vector<int> &parent_map)
+{
+	const uint index = ((y % TILE_DRAW_CACHE_CHUNK_SIZE) * TILE_DRAW_CACHE_CHUNK_SIZE) + (x % TILE_DRAW_CACHE_CHUNK_SIZE);
+	const TileDrawCacheTile &cached = chunk.tiles[index];
+	const uint32_t tile_sprites_begin = index > 0 ? chunk.tiles[index - 1].tile_sprites_end : 0;
+	const uint32_t parent_sprites_begin = index > 0 ? chunk.tiles[index - 1].parent_sprites_end : 0;
+	const uint32_t child_sprites_begin = index > 0 ? chunk.tiles[index - 1].child_sprites_end : 0;
+
+	vdd->tile_sprites_to_draw.insert(vdd->tile_sprites_to_draw.end(), chunk.tile_sprites.begin() + tile_sprites_begin, chunk.tile_sprites.begin() + cached.tile_sprites_end);
+
+	const int child_offset = (int)vdd->child_screen_sprites_to_draw.size() - (int)child_sprites_begin;
+	for (uint32_t i = child_sprites_begin; i < cached.child_sprites_end; i++) {
+		ChildScreenSpriteToDraw &cs = vdd->child_screen_sprites_to_draw.emplace_back(chunk.child_sprites[i]);
+		if (cs.next >= 0) cs.next += child_offset;
+	}
+
+	/* New index of each parent sprite of the tile, or -1 if culled */
+	parent_map.clear();
+	const DrawPixelInfo &dpi = vdd->dpi;
+	for (uint32_t i = parent_sprites_begin; i < cached.parent_sprites_end; i++) {
+		const ParentSpriteToDraw &cached_ps = chunk.parent_sprites[i];
+		if (cached_ps.first_child < 0 && (cached_ps.left >= dpi.left + dpi.width || cached_ps.left + cached_ps.width <= dpi.left ||
+				cached_ps.top >= dpi.top + dpi.height || cached_ps.top + cached_ps.height <= dpi.top)) {
+			parent_map.push_back(-1);
+			continue;
+		}
+		parent_map.push_back((int)vdd->parent_sprites_to_draw.size());
+		ParentSpriteToDraw &ps = vdd->parent_sprites_to_draw.emplace_back(cached_ps);
+		vdd->parent_sprite_subsprites.Set(&ps, chunk.parent_sprite_subsprites.Get(&cached_ps));
+		if (ps.first_child >= 0) ps.first_child += child_offset;
+	}
+
+	TileDrawFoundationState state = cached.state;
+	state.Translate([&](ChildStoreID store) -> ChildStoreID {
+		if (store == NO_CHILD_STORE) return NO_CHILD_STORE;
+		if ((store & CHILD_SPRITE_STORE_TAG) != 0) return static_cast<ChildStoreID>((int)(store & ~CHILD_SPRITE_STORE_TAG) + child_offset) | CHILD_SPRITE_STORE_TAG;
+		int parent = parent_map[store - parent_sprites_begin];
+		return parent >= 0 ? static_cast<ChildStoreID>(parent) : NO_CHILD_STORE;
+	});
+	return state;
+}
+
+/** Visible tile whose sprites are replayed from the landscape sprite cache after all tiles have been visited. */
+struct DeferredCachedTile {
+	const TileDrawCacheChunk *chunk;
+	uint x;
+	uint y;
+	bool draw_selection; ///< Whether the tile selection and zoning should be drawn.
+};
+static std::vector<DeferredCachedTile> _deferred_cached_tiles;
+
+/** Number of cached tiles replayed into each strip buffer. */
+static constexpr size_t CACHED_TILE_STRIP_SIZE = 1024;
+
+/**
+ * Draw the tile selection and zoning of a cached tile.
+ * @param tile Tile.
+ * @param state Foundation state of the tile, with indices into the sprites of #_vdd.
+ */
+static void DrawCachedTileSelection(const DeferredCachedTile &tile, const TileDrawFoundationState &state)
+{
+	state.Restore();
+	SetupCurrentTileInfo(TileXY(tile.x, tile.y));
+	DrawTileSelection(&_cur_ti);
+	DrawTileZoning(&_cur_ti);
+}
+
+/**
+ * Add the sprites of all deferred cached tiles to #_vdd.
+ * Large drawing areas are split into strips of tiles, which are replayed into separate viewport drawers by the worker threads.
+ * The strips are then merged in order, and the tile selection is drawn on top of each strip.
+ */
+static void ViewportAddCachedTiles()
+{
+	std::vector<DeferredCachedTile> &tiles = _deferred_cached_tiles;
+	static std::vector<int> parent_map;
+
+	if (tiles.size() < 2 * CACHED_TILE_STRIP_SIZE || HasBit(_viewport_debug_flags, VDF_DISABLE_THREAD)) {
+		for (const DeferredCachedTile &tile : tiles) {
+			TileDrawFoundationState state = AddCachedTileSpritesToDraw(_vdd.get(), *tile.chunk, tile.x, tile.y, parent_map);
+			if (tile.draw_selection) DrawCachedTileSelection(tile, state);
+		}
+		tiles.clear();
+		return;
+	}
+
+	static std::vector<std::unique_ptr<ViewportDrawerDynamic>> strip_drawers;
+	static std::vector<TileDrawFoundationState> states;
+	const size_t strips = CeilDivT<size_t>(tiles.size(), CACHED_TILE_STRIP_SIZE);
+	while (strip_drawers.size() < strips) strip_drawers.push_back(std::make_unique<ViewportDrawerDynamic>());
+	for (size_t i = 0; i < strips; i++) {
+		strip_drawers[i]->dpi = _vdd->dpi;
+	}
+	states.resize(tiles.size());
+
+	_general_worker_pool.RunParallelChunks(tiles.size(), CACHED_TILE_STRIP_SIZE, [&](size_t begin, size_t end) {
+		ViewportDrawerDynamic *vdd = strip_drawers[begin / CACHED_TILE_STRIP_SIZE].get();
+		std::vector<int> strip_parent_map;
+		for (size_t i = begin; i < end; i++) {
+			states[i] = AddCachedTileSpritesToDraw(vdd, *tiles[i].chunk, tiles[i].x, tiles[i].y, strip_parent_map);
+		}
+	});
+
+	for (size_t strip = 0; strip < strips; strip++) {
+		ViewportDrawerDynamic *vdd = strip_drawers[strip].get();
+		const int parent_offset = (int)_vdd->parent_sprites_to_draw.size();
+		const int child_offset = (int)_vdd->child_screen_sprites_to_draw.size();
+
+		_vdd->tile_sprites_to_draw.insert(_vdd->tile_sprites_to_draw.end(), vdd->tile_sprites_to_draw.begin(), vdd->tile_sprites_to_draw.end());
+		for (const ChildScreenSpriteToDraw &strip_cs : vdd->child_screen_sprites_to_draw) {
+			ChildScreenSpriteToDraw &cs = _vdd->child_screen_sprites_to_draw.emplace_back(strip_cs);
+			if (cs.next >= 0) cs.next += child_offset;
+		}
+		for (const ParentSpriteToDraw &strip_ps : vdd->parent_sprites_to_draw) {
+			ParentSpriteToDraw &ps = _vdd->parent_sprites_to_draw.emplace_back(strip_ps);
+			_vdd->parent_sprite_subsprites.Set(&ps, vdd->parent_sprite_subsprites.Get(&strip_ps));
+			if (ps.first_child >= 0) ps.first_child += child_offset;
+		}
+		vdd->tile_sprites_to_draw.clear();
+		vdd->parent_sprites_to_draw.clear();
+		vdd->parent_sprite_subsprites.Clear();
+		vdd->child_screen_sprites_to_draw.clear();
+
+		const size_t end = std::min(tiles.size(), (strip + 1) * CACHED_TILE_STRIP_SIZE);
+		for (size_t i = strip * CACHED_TILE_STRIP_SIZE; i < end; i++) {
+			if (!tiles[i].draw_selection) continue;
+			states[i].Translate([&](ChildStoreID store) -> ChildStoreID {
+				if (store == NO_CHILD_STORE) return NO_CHILD_STORE;
+				if ((store & CHILD_SPRITE_STORE_TAG) != 0) return static_cast<ChildStoreID>((int)(store & ~CHILD_SPRITE_STORE_TAG) + child_offset) | CHILD_SPRITE_STORE_TAG;
+				return static_cast<ChildStoreID>((int)store + parent_offset);
+			});
+			DrawCachedTileSelection(tiles[i], states[i]);
+		}
+	}
+
+	tiles.clear();
+}
+
+/**
+ * Clear the whole landscape sprite cache.
+ */
+void ClearTileDrawCache()
+{
+	TileDrawCache &cache = _tile_draw_cache;
+	if (cache.chunk_count == 0) return;
+	for (auto &chunks : cache.chunks) {
+		chunks.clear();
+	}
+	std::fill(cache.chunk_zoom_masks.begin(), cache.chunk_zoom_masks.end(), 0);
+	cache.chunk_count = 0;
+	cache.sprite_count = 0;
+}
+
+/**
+ * Invalidate the cached landscape sprites of a tile and its neighbours, as the appearance of a tile can depend on its neighbours.
+ * @param tile The tile.
+ */
+void MarkTileDrawCacheDirty(TileIndex tile)
+{
+	TileDrawCache &cache = _tile_draw_cache;
+	if (cache.chunk_count == 0) return;
+
+	const uint x = TileX(tile);
+	const uint y = TileY(tile);
+	const uint max_chunk_x = (1 << cache.chunk_shift_x) - 1;
+	const uint max_chunk_y = (uint)(cache.chunk_zoom_masks.size() >> cache.chunk_shift_x) - 1;
+	const uint chunk_x_begin = x > 0 ? (x - 1) >> TILE_DRAW_CACHE_CHUNK_SHIFT : 0;
+	const uint chunk_x_end = std::min<uint>((x + 1) >> TILE_DRAW_CACHE_CHUNK_SHIFT, max_chunk_x);
+	const uint chunk_y_begin = y > 0 ? (y - 1) >> TILE_DRAW_CACHE_CHUNK_SHIFT : 0;
+	const uint chunk_y_end = std::min<uint>((y + 1) >> TILE_DRAW_CACHE_CHUNK_SHIFT, max_chunk_y);
+
+	for (uint chunk_y = chunk_y_begin; chunk_y <= chunk_y_end; chunk_y++) {
+		for (uint chunk_x = chunk_x_begin; chunk_x <= chunk_x_end; chunk_x++) {
+			const uint32_t chunk_index = (chunk_y << cache.chunk_shift_x) | chunk_x;
+			uint8_t &zoom_mask = cache.chunk_zoom_masks[chunk_index];
+			for (uint8_t zoom : SetBitIterator<uint8_t>(zoom_mask)) {
+				auto iter = cache.chunks[zoom].find(chunk_index);
+				cache.chunk_count--;
+				cache.sprite_count -= iter->second.SpriteCount();
+				cache.chunks[zoom].erase(iter);
+			}
+			zoom_mask = 0;
+		}
+	}
+}
+
 /**
  * Add the landscape to the viewport, i.e. all ground tiles and buildings.
  */
@@ -1853,6 +2242,9 @@ static void ViewportAddLandscape()
 
 	int potential_bridge_height = ZOOM_BASE * TILE_HEIGHT * _settings_game.construction.max_bridge_height;
 
+	const bool use_tile_draw_cache = !HasBit(_viewport_debug_flags, VDF_DISABLE_TILE_DRAW_CACHE) && !_draw_bounding_boxes;
+	if (use_tile_draw_cache) PrepareTileDrawCache();
+
 	/* Rows overlap with neighbouring rows by a half tile.
 	 * The first row that could possibly be visible is the row above upper_left (if it is at height 0).
 	 * Due to integer-division not rounding down for negative numbers, we need another decrement.
@@ -1932,6 +2324,11 @@ static void ViewportAddLandscape()
 
 			if (tile_visible) {
 				last_row = false;
+				if (use_tile_draw_cache && tile_type != MP_VOID) {
+					_deferred_cached_tiles.push_back({ &GetTileDrawCacheChunk(tilecoord.x, tilecoord.y), (uint)tilecoord.x, (uint)tilecoord.y, min_visible_height <= 0 });
+					continue;
+				}
+
 				_vd.foundation_part = FOUNDATION_PART_NONE;
 				_vd.foundation[0] = -1;
 				_vd.foundation[1] = -1;
@@ -1947,6 +2344,8 @@ static void ViewportAddLandscape()
 			}
 		}
 	}
+
+	if (use_tile_draw_cache) ViewportAddCachedTiles();
 }
 
 /**
@@ -4688,6 +5087,7 @@ void MarkAllViewportMapLandscapesDirty()
 
 void MarkWholeNonMapViewportsDirty()
 {
+	ClearTileDrawCache();
 	for (Window *w : Window::Iterate()) {
 		Viewport *vp = w->viewport;
 		if (vp != nullptr && vp->zoom < ZOOM_LVL_DRAW_MAP) {
@@ -4733,6 +5133,7 @@ void ConstrainAllViewportsZoom()
  */
 void MarkTileDirtyByTile(TileIndex tile, ViewportMarkDirtyFlags flags, int bridge_level_offset, int tile_height_override)
 {
+	if (!(flags & VMDF_NOT_LANDSCAPE)) MarkTileDrawCacheDirty(tile);
 	Point pt = RemapCoords(TileX(tile) * TILE_SIZE, TileY(tile) * TILE_SIZE, tile_height_override * TILE_HEIGHT);
 	MarkAllViewportsDirty(
 			pt.x - 31  * ZOOM_BASE,
@@ -4745,6 +5146,7 @@ void MarkTileDirtyByTile(TileIndex tile, ViewportMarkDirtyFlags flags, int bridg
 
 void MarkTileGroundDirtyByTile(TileIndex tile, ViewportMarkDirtyFlags flags)
 {
+	if (!(flags & VMDF_NOT_LANDSCAPE)) MarkTileDrawCacheDirty(tile);
 	int x = TileX(tile) * TILE_SIZE;
 	int y = TileY(tile) * TILE_SIZE;
 	Point top = RemapCoords(x, y, GetTileMaxPixelZ(tile));
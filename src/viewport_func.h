@@ -137,6 +137,9 @@ inline void MarkTileDirtyByTile(TileIndex tile, ViewportMarkDirtyFlags flags = V
 
 void MarkTileGroundDirtyByTile(TileIndex tile, ViewportMarkDirtyFlags flags);
 
+void MarkTileDrawCacheDirty(TileIndex tile);
+void ClearTileDrawCache();
+
 void ChangeRenderMode(Viewport *vp, bool down);
 
 Point GetViewportStationMiddle(const Viewport *vp, const Station *st);
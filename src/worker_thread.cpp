@@ -11,6 +11,9 @@
 #include "worker_thread.h"
 #include "thread.h"
 
+#include <atomic>
+#include <memory>
+
 #include "safeguards.h"
 
 WorkerThreadPool _general_worker_pool;
@@ -61,6 +64,86 @@ void WorkerThreadPool::EnqueueJob(WorkerJobFunc *func, void *data1, void *data2,
 	if (notify) this->worker_wait_cv.notify_one();
 }
 
+/** Shared state of a RunParallelChunks call. */
+struct WorkerParallelChunksState {
+	std::atomic<size_t> next_chunk{0};
+	std::atomic<size_t> chunks_remaining;
+	size_t count;
+	size_t chunk_size;
+	const std::function<void(size_t, size_t)> *func;
+	std::mutex lock;
+	std::condition_variable done_cv;
+
+	WorkerParallelChunksState(size_t count, size_t chunk_size, size_t chunks, const std::function<void(size_t, size_t)> *func)
+			: chunks_remaining(chunks), count(count), chunk_size(chunk_size), func(func) {}
+
+	void ProcessChunks()
+	{
+		while (true) {
+			size_t chunk = this->next_chunk.fetch_add(1, std::memory_order_relaxed);
+			size_t begin = chunk * this->chunk_size;
+			if (begin >= this->count) return;
+			(*this->func)(begin, std::min(begin + this->chunk_size, this->count));
+			if (this->chunks_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				std::lock_guard<std::mutex> lk(this->lock);
+				this->done_cv.notify_all();
+			}
+		}
+	}
+};
+
+/**
+ * Run a function over the range [0, count), split into chunks which are processed concurrently
+ * by the calling thread and the worker threads. This returns once all chunks have been processed.
+ * @param count Size of the range.
+ * @param chunk_size Maximum size of each chunk.
+ * @param func Function to call with the begin and end of each chunk.
+ * @note func must not throw.
+ */
+void WorkerThreadPool::RunParallelChunks(size_t count, size_t chunk_size, const std::function<void(size_t, size_t)> &func)
+{
+	if (count == 0) return;
+	chunk_size = std::max<size_t>(chunk_size, 1);
+	size_t chunks = (count + chunk_size - 1) / chunk_size;
+	uint workers;
+	{
+		std::lock_guard<std::mutex> lk(this->lock);
+		workers = this->workers;
+	}
+	if (chunks == 1 || workers == 0) {
+		func(0, count);
+		return;
+	}
+
+	/* Worker jobs may start after all chunks have been completed, so the state is reference counted. */
+	auto state = std::make_shared<WorkerParallelChunksState>(count, chunk_size, chunks, &func);
+	size_t jobs = std::min<size_t>(chunks - 1, workers);
+	for (size_t i = 0; i < jobs; i++) {
+		this->EnqueueJob([](void *data1, void *, void *) {
+			std::unique_ptr<std::shared_ptr<WorkerParallelChunksState>> job_state(static_cast<std::shared_ptr<WorkerParallelChunksState> *>(data1));
+			(*job_state)->ProcessChunks();
+		}, new std::shared_ptr<WorkerParallelChunksState>(state));
+	}
+
+	state->ProcessChunks();
+
+	std::unique_lock<std::mutex> lk(state->lock);
+	state->done_cv.wait(lk, [&]() { return state->chunks_remaining.load(std::memory_order_acquire) == 0; });
+}
+
+/**
+ * Called in a child process created by fork(), in which the worker threads do not exist.
+ * Jobs are executed on the calling thread from now on.
+ * @note The pool must have been idle when fork() was called.
+ */
+void WorkerThreadPool::DetachAfterFork()
+{
+	std::lock_guard<std::mutex> lk(this->lock);
+	this->workers = 0;
+	this->workers_waiting = 0;
+	assert(this->jobs.empty());
+}
+
 void WorkerThreadPool::Run(WorkerThreadPool *pool)
 {
 	std::unique_lock<std::mutex> lk(pool->lock);
@@ -13,9 +13,13 @@
 #include "core/ring_buffer_queue.hpp"
 #include <mutex>
 #include <condition_variable>
+#include <functional>
 
 typedef void WorkerJobFunc(void *, void *, void *);
 
+/** Number of tiles per chunk when running a whole map pass using WorkerThreadPool::RunParallelChunks. */
+static constexpr size_t WORKER_MAP_CHUNK_SIZE = 1 << 16;
+
 struct WorkerThreadPool {
 private:
 	struct WorkerJob {
@@ -40,6 +44,8 @@ public:
 	void Start(const char *thread_name, uint max_workers);
 	void Stop();
 	void EnqueueJob(WorkerJobFunc *func, void *data1 = nullptr, void *data2 = nullptr, void *data3 = nullptr);
+	void RunParallelChunks(size_t count, size_t chunk_size, const std::function<void(size_t, size_t)> &func);
+	void DetachAfterFork();
 
 	~WorkerThreadPool()
 	{